@@ -4,3 +4,4 @@ rm -f Record__Note Record__Timing Record__TimeStep Record__PatchCount Record__Du
       PowerSpec_* Particle_* nohup.out Record__Performance Record__TimingMPI_* \
       Record__ParticleCount Record__User Patch_* Record__NCorrUnphy FailedPatchGroup* *.pyc Record__LoadBalance \
       GRACKLE_INFO  Record__DivB
+rm -rf Precision_Double Precision_Mixed
@@ -0,0 +1,54 @@
+#!/bin/bash
+
+# Compare the accuracy and performance of the double- and mixed-precision modes of the exact cooling
+#
+# Usage: sh compare_precision.sh [GAMER executable (default: ./gamer)]
+#
+# --> Run this test twice in "Precision_Double" and "Precision_Mixed" with SRC_EC_MIXED_PRECISION = 0 and 1
+# --> Enable OPT__OUTPUT_USER and disable OPT__OUTPUT_TOTAL in both runs so that the error is recorded in
+#     "Output__Error" at every dump
+# --> Report the relative error of both runs at every dump and the total time spent on the source terms
+#     (i.e., "Src_Adv" in Record__Timing, which requires TIMING in the Makefile)
+
+
+GAMER=$(readlink -f ${1:-./gamer})
+
+if [ ! -x "$GAMER" ]; then
+   echo "ERROR : GAMER executable \"$GAMER\" does not exist !!"
+   exit 1
+fi
+
+
+# run the two modes
+for MODE in Double Mixed
+do
+   if [ "$MODE" = "Double" ]; then MIXED=0; else MIXED=1; fi
+
+   DIR=Precision_$MODE
+   rm -rf $DIR
+   mkdir $DIR
+   cp Input__Parameter Input__TestProb $DIR/
+
+   sed -i -e "s/^SRC_EC_MIXED_PRECISION .*/SRC_EC_MIXED_PRECISION        $MIXED/" \
+          -e "s/^OPT__OUTPUT_USER .*/OPT__OUTPUT_USER              1/" \
+          -e "s/^OPT__OUTPUT_TOTAL .*/OPT__OUTPUT_TOTAL             0/" $DIR/Input__Parameter
+
+   echo "Running SRC_EC_MIXED_PRECISION = $MIXED in $DIR ..."
+   ( cd $DIR && $GAMER > log 2>&1 ) || { echo "ERROR : run in $DIR failed (see $DIR/log) !!"; exit 1; }
+done
+
+
+# accuracy: relative error of each mode and the relative temperature difference between them
+echo ""
+printf "%14s %14s %14s %14s\n" "Time" "Err_Double" "Err_Mixed" "dTemp/Temp"
+paste <(grep -v "^#" Precision_Double/Output__Error) <(grep -v "^#" Precision_Mixed/Output__Error) | \
+awk -v n=7 '{ dT = ($(n+3)-$3)/$3; printf "%14.7e %14.7e %14.7e %14.7e\n", $1, $5, $(n+5), dT }'
+
+
+# performance: total time spent on the source terms
+echo ""
+for MODE in Double Mixed
+do
+   awk -v mode=$MODE '/^Summary/ { getline; getline; getline; t += $5 }
+                      END { printf "Src_Adv (%6s) = %10.4f s\n", mode, t }' Precision_$MODE/Record__Timing
+done
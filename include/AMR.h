@@ -26,11 +26,202 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PatchTable_t
+// Description :  Growable table of the patch pointers at a single level and sandglass
+//
+// Note        :  1. Replace the fixed-size array "patch_t *patch[MAX_PATCH]"
+//                   --> amr->patch[Sg][lv][PID] still returns a reference to the patch pointer in O(1) time
+//                2. Patch pointers are stored in chunks of PATCH_TABLE_CHUNK entries allocated on demand
+//                   --> chunks never move, so the addresses of the table entries remain valid when the
+//                       table grows (e.g., for Aux_SwapPointer)
+//                3. Grow() and Shrink() may reallocate the chunk directory and thus must NOT be called
+//                   concurrently with any other access to the same table
+//
+// Data Member :  Chunk     : Chunk directory
+//                NChunk    : Number of allocated chunks
+//                NChunkCap : Capacity of the chunk directory
+//
+// Method      :  PatchTable_t : Constructor
+//               ~PatchTable_t : Destructor
+//                operator[]   : Return the patch pointer of the target PID
+//                Size         : Number of addressable PIDs
+//                Grow         : Allocate chunks so that the target PID becomes addressable
+//                Shrink       : Deallocate the trailing chunks storing no patches
+//-------------------------------------------------------------------------------------------------------
+struct PatchTable_t
+{
+
+// data members
+// ===================================================================================
+   patch_t ***Chunk;
+   int        NChunk;
+   int        NChunkCap;
+
+
+
+   //===================================================================================
+   // Constructor :  PatchTable_t
+   // Description :  Constructor of the structure "PatchTable_t"
+   //
+   // Note        :  No chunk is allocated until Grow() is invoked
+   //===================================================================================
+   PatchTable_t()
+   {
+
+      Chunk     = NULL;
+      NChunk    = 0;
+      NChunkCap = 0;
+
+   } // METHOD : PatchTable_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~PatchTable_t
+   // Description :  Destructor of the structure "PatchTable_t"
+   //
+   // Note        :  Only deallocate the table itself but not the patches it points to
+   //===================================================================================
+   ~PatchTable_t()
+   {
+
+      for (int c=0; c<NChunk; c++)  delete [] Chunk[c];
+
+      delete [] Chunk;
+
+   } // METHOD : ~PatchTable_t
+
+
+
+   //===================================================================================
+   // Method      :  operator[]
+   // Description :  Return the patch pointer of the target PID
+   //
+   // Note        :  1. PID must be smaller than Size()
+   //                2. Return a reference so that the pointer can be reset and its address can be taken
+   //===================================================================================
+   patch_t *&operator[]( const int PID )
+   {
+
+#     ifdef GAMER_DEBUG
+      if ( PID < 0  ||  PID >= Size() )
+         Aux_Error( ERROR_INFO, "PID (%d) lies outside the patch table (size %d) !!\n", PID, Size() );
+#     endif
+
+      return Chunk[ PID >> PATCH_TABLE_CHUNK_BIT ][ PID & (PATCH_TABLE_CHUNK-1) ];
+
+   } // METHOD : operator[]
+
+   patch_t *operator[]( const int PID ) const
+   {
+
+#     ifdef GAMER_DEBUG
+      if ( PID < 0  ||  PID >= Size() )
+         Aux_Error( ERROR_INFO, "PID (%d) lies outside the patch table (size %d) !!\n", PID, Size() );
+#     endif
+
+      return Chunk[ PID >> PATCH_TABLE_CHUNK_BIT ][ PID & (PATCH_TABLE_CHUNK-1) ];
+
+   } // METHOD : operator[] const
+
+
+
+   //===================================================================================
+   // Method      :  Size
+   // Description :  Return the number of addressable PIDs (i.e., 0 <= PID < Size())
+   //===================================================================================
+   int Size() const
+   {
+
+      return NChunk*PATCH_TABLE_CHUNK;
+
+   } // METHOD : Size
+
+
+
+   //===================================================================================
+   // Method      :  Grow
+   // Description :  Allocate new chunks so that the target PID becomes addressable
+   //
+   // Note        :  1. New entries are initialized as NULL
+   //                2. The chunk directory grows by a factor of two
+   //
+   // Parameter   :  PID : Target patch ID
+   //===================================================================================
+   void Grow( const int PID )
+   {
+
+      if ( PID < Size() )  return;
+
+      const int NChunkNew = ( PID >> PATCH_TABLE_CHUNK_BIT ) + 1;
+
+//    enlarge the chunk directory
+      if ( NChunkNew > NChunkCap )
+      {
+         int NChunkCapNew = ( NChunkCap == 0 ) ? 1 : 2*NChunkCap;
+         while ( NChunkCapNew < NChunkNew )  NChunkCapNew *= 2;
+
+         patch_t ***ChunkNew = new patch_t** [NChunkCapNew];
+         for (int c=0; c<NChunk; c++)  ChunkNew[c] = Chunk[c];
+
+         delete [] Chunk;
+         Chunk     = ChunkNew;
+         NChunkCap = NChunkCapNew;
+      }
+
+//    allocate new chunks
+      for (int c=NChunk; c<NChunkNew; c++)
+      {
+         Chunk[c] = new patch_t* [PATCH_TABLE_CHUNK];
+
+         for (int t=0; t<PATCH_TABLE_CHUNK; t++)   Chunk[c][t] = NULL;
+      }
+
+      NChunk = NChunkNew;
+
+   } // METHOD : Grow
+
+
+
+   //===================================================================================
+   // Method      :  Shrink
+   // Description :  Deallocate the trailing chunks storing no patches
+   //
+   // Note        :  1. Chunks storing any PID < NKeep are always kept
+   //                2. Chunks storing any non-NULL pointer (e.g., inactive patches kept for
+   //                   OPT__REUSE_MEMORY) are always kept
+   //                3. Do not shrink the chunk directory, which is small
+   //
+   // Parameter   :  NKeep : Number of PIDs to be kept
+   //===================================================================================
+   void Shrink( const int NKeep )
+   {
+
+      while ( NChunk > 0  &&  (NChunk-1)*PATCH_TABLE_CHUNK >= NKeep )
+      {
+         const patch_t *const *LastChunk = Chunk[ NChunk-1 ];
+
+         for (int t=0; t<PATCH_TABLE_CHUNK; t++)
+            if ( LastChunk[t] != NULL )   return;
+
+         delete [] Chunk[ NChunk-1 ];
+         NChunk --;
+      }
+
+   } // METHOD : Shrink
+
+
+}; // struct PatchTable_t
+
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Structure   :  AMR_t
 // Description :  Data structure of the AMR implementation
 //
-// Data Member :  patch        : Pointers of all patches
+// Data Member :  patch        : Tables of the pointers of all patches (see PatchTable_t)
 //                num          : Number of patches (real patch + buffer patch) at each level
 //                scale        : Grid scale at each level (grid size normalized to that at the finest level)
 //                FluSg        : Sandglass of the current fluid          data [0/1]
@@ -68,15 +259,17 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 // Method      :  AMR_t    : Constructor
 //               ~AMR_t    : Destructor
 //                pnew     : Allocate one patch
+//                Lvreserve: Reserve consecutive patch indices in the given level
 //                pdelete  : Deallocate one patch
 //                Lvdelete : Deallocate all patches in the given level
+//                Lvcompact: Release the unused tail of the patch tables in the given level
 //-------------------------------------------------------------------------------------------------------
 struct AMR_t
 {
 
 // data members
 // ===================================================================================
-   patch_t    *patch[2][NLEVEL][MAX_PATCH];
+   PatchTable_t patch[2][NLEVEL];
 
 #  ifdef PARTICLE
    Particle_t *Par;
@@ -154,11 +347,6 @@ struct AMR_t
 #        endif
       }
 
-      for (int Sg=0; Sg<2; Sg++)
-      for (int lv=0; lv<NLEVEL; lv++)
-      for (int PID=0; PID<MAX_PATCH; PID++)
-         patch[Sg][lv][PID] = NULL;
-
       for (int lv=0; lv<NLEVEL; lv++)
       for (int m=0; m<28; m++)
          NPatchComma[lv][m] = 0;
@@ -196,6 +384,18 @@ struct AMR_t
       const bool ReusePatchMemory_No = false;
       for (int lv=0; lv<NLEVEL; lv++)  Lvdelete( lv, ReusePatchMemory_No );
 
+//    deallocate the inactive patches kept for OPT__REUSE_MEMORY
+      for (int Sg=0; Sg<2; Sg++)
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int PID=0; PID<patch[Sg][lv].Size(); PID++)
+      {
+         if ( patch[Sg][lv][PID] != NULL )
+         {
+            delete patch[Sg][lv][PID];
+            patch[Sg][lv][PID] = NULL;
+         }
+      }
+
 #     ifdef PARTICLE
       if ( Par != NULL )
       {
@@ -231,6 +431,16 @@ struct AMR_t
    // Note        :  1. Each patch contains two patch pointers --> SANDGLASS (Sg) = 0 / 1
    //                2. Sg = 0 : Store both data and relation (father,son.sibling,corner,flag,flux)
    //                   Sg = 1 : Store only data
+   //                3. Patch tables grow on demand
+   //                4. By default the new patch is appended to the end of the patch list (i.e., PID = num[lv])
+   //                   --> Not thread-safe
+   //                5. Alternatively, one can allocate a patch at an index reserved in advance by Lvreserve()
+   //                   --> Thread-safe as long as different threads allocate different PIDs
+   //                   --> Useful for allocating patches in parallel with a deterministic PID assignment
+   //                6. fluid[] of each sandglass is allocated as a slice of a block shared by the patch group
+   //                   --> The 8 patches of a group must be allocated in order by the same thread for their
+   //                       fluid data to be contiguous, which is the case for all callers
+   //                   --> See PatchArena_AllocGroup()
    //
    // Parameter   :  lv          : Target refinement level
    //                scale_x/y/z : Grid scale indices (not physical coordinates) of the patch corner
@@ -238,15 +448,31 @@ struct AMR_t
    //                FluData     : true --> Allocate fluid[]
    //                MagData     : true --> Allocate magnetic[]
    //                PotData     : true --> Allocate pot[]
+   //                ReservedPID : Patch ID reserved by Lvreserve()
+   //                              --> Append a new patch to the end of the patch list if it is negative
    //===================================================================================
    void pnew( const int lv, const int scale_x, const int scale_y, const int scale_z, const int FaPID,
-              const bool FluData, const bool MagData, const bool PotData )
+              const bool FluData, const bool MagData, const bool PotData, const int ReservedPID=-1 )
    {
 
-      const int NewPID = num[lv];
+      const int NewPID = ( ReservedPID >= 0 ) ? ReservedPID : num[lv];
+
+      if ( ReservedPID < 0 )
+      {
+         if ( NewPID > MAX_PATCH-1 )
+            Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please increase or remove it in the Makefile !!\n", MAX_PATCH );
+
+         patch[0][lv].Grow( NewPID );
+         patch[1][lv].Grow( NewPID );
+      }
+
+#     ifdef GAMER_DEBUG
+      else if ( NewPID >= num[lv] )
+         Aux_Error( ERROR_INFO, "PID %d has not been reserved (Lv %d, NPatch %d) !!\n", NewPID, lv, num[lv] );
+#     endif
 
-      if ( NewPID > MAX_PATCH-1 )
-         Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
+//    fluid[] is allocated separately below
+      const bool AllocFlu_No = false;
 
 //    allocate new patches if there are no inactive patches
       if ( patch[0][lv][NewPID] == NULL )
@@ -257,9 +483,9 @@ struct AMR_t
             Aux_Error( ERROR_INFO, "conflicting patch allocation (Lv %d, PID %d, FaPID %d) !!\n", lv, NewPID, FaPID );
 #        endif
 
-         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, AllocFlu_No, MagData, PotData, FluData, lv,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
-         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, AllocFlu_No, MagData, PotData,   false, lv,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
       }
 
@@ -280,18 +506,57 @@ struct AMR_t
 //       do NOT initialize field pointers as NULL since they may be allocated already
          const bool InitPtrAsNull_No = false;
 
-         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, AllocFlu_No, MagData, PotData, FluData, lv,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
-         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, AllocFlu_No, MagData, PotData,   false, lv,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
       } // if ( patch[0][lv][NewPID] == NULL ) ... else ...
 
-      num[lv] ++;
+//    allocate fluid[] from the blocks of the patch group (do nothing if it has been allocated already)
+      if ( FluData )
+      for (int Sg=0; Sg<2; Sg++)    patch[Sg][lv][NewPID]->hnew( NewPID%8, Sg );
+
+      if ( ReservedPID < 0 )  num[lv] ++;
 
    } // METHOD : pnew
 
 
 
+   //===================================================================================
+   // Method      :  Lvreserve
+   // Description :  Reserve consecutive patch indices at the end of the patch list in the target level
+   //
+   // Note        :  1. num[lv] is increased by NPatch immediately, but the reserved patches are NOT allocated here
+   //                   --> They must be allocated by pnew() with the argument "ReservedPID" before being accessed
+   //                2. Patch tables are enlarged here so that pnew() with reserved PIDs does not need to
+   //                   modify the tables and can thus be invoked by multiple threads
+   //
+   // Parameter   :  lv     : Target refinement level
+   //                NPatch : Number of patch indices to be reserved
+   //
+   // Return      :  First reserved patch index
+   //===================================================================================
+   int Lvreserve( const int lv, const int NPatch )
+   {
+
+      const int PID0 = num[lv];
+
+      if ( NPatch <= 0 )   return PID0;
+
+      if ( (long)PID0 + NPatch > (long)MAX_PATCH )
+         Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please increase or remove it in the Makefile !!\n", MAX_PATCH );
+
+      patch[0][lv].Grow( PID0 + NPatch - 1 );
+      patch[1][lv].Grow( PID0 + NPatch - 1 );
+
+      num[lv] += NPatch;
+
+      return PID0;
+
+   } // METHOD : Lvreserve
+
+
+
    //===================================================================================
    // Method      :  pdelete
    // Description :  Deallocate a single patch
@@ -409,6 +674,39 @@ struct AMR_t
    } // METHOD : Lvdelete
 
 
+
+   //===================================================================================
+   // Method      :  Lvcompact
+   // Description :  Release the unused tail of the patch tables in the target level
+   //
+   // Note        :  1. Active patches are always stored densely in PID = [0 ... num[lv]-1] since
+   //                   Refine() and LB_Refine() move the deleted patches to the end of the list
+   //                   --> this function only deallocates the trailing chunks beyond num[lv]
+   //                2. Keep one spare chunk to avoid reallocating chunks repeatedly when the number
+   //                   of patches oscillates around the chunk boundary
+   //                3. Inactive patches kept for OPT__REUSE_MEMORY are not deallocated
+   //
+   // Parameter   :  lv : Target refinement level
+   //===================================================================================
+   void Lvcompact( const int lv )
+   {
+
+#     ifdef GAMER_DEBUG
+      if ( lv < 0  ||  lv >= NLEVEL )
+         Aux_Error( ERROR_INFO, "incorrect parameter %s = %d\" !!\n", "lv", lv );
+
+      for (int PID=0; PID<num[lv]; PID++)
+      for (int Sg=0; Sg<2; Sg++)
+         if ( patch[Sg][lv][PID] == NULL  ||  !patch[Sg][lv][PID]->Active )
+            Aux_Error( ERROR_INFO, "active patches are not dense (Lv %d, PID %d, Sg %d, NPatch %d) !!\n",
+                       lv, PID, Sg, num[lv] );
+#     endif
+
+      for (int Sg=0; Sg<2; Sg++)    patch[Sg][lv].Shrink( num[lv] + PATCH_TABLE_CHUNK );
+
+   } // METHOD : Lvcompact
+
+
 }; // struct AMR_t
 
 
@@ -160,6 +160,39 @@
 #endif
 
 
+// CPU only: perform the PLM/PPM data reconstruction of MHM/MHM_RP along the x-direction pencils
+// --> the slope limiter and the PPM interpolation are applied to a whole row of one variable at a time
+//     (e.g., Hydro_LimitSlope_Pencil()) so that compilers can vectorize them, and the face-centered
+//     primitive variables are written to g_FC_Var[] directly before being converted to conserved variables
+// --> do not support CTU, MHD, CHAR_RECONSTRUCTION, and LR_EINT for now
+#  define LR_PENCIL
+
+#if (  defined LR_PENCIL  &&  \
+       ( defined __CUDACC__  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP )  ||  defined MHD  ||  \
+         defined CHAR_RECONSTRUCTION  ||  defined LR_EINT )  )
+#  undef LR_PENCIL
+#endif
+
+
+// CPU only: support converting the conserved variables to primitive variables in Flu_Prepare() for the MHM scheme
+// (i.e., OPT__FLU_PREP_PRI) so that the fluid solver can skip the conversion at the beginning of the data reconstruction
+// --> the primitive variables are stored in arrays with the same layout as h_Flu_Array_F_In[] and thus require
+//     NCOMP_LR == FLU_NIN (i.e., no MHD and LR_EINT)
+#if ( FLU_SCHEME == MHM  &&  !defined GPU  &&  !defined MHD  &&  !defined LR_EINT )
+#  define FLU_PREP_PRI
+#endif
+
+
+// CPU only: support advancing each patch group in z-slabs through the data reconstruction, flux evaluation,
+// and full-step update (i.e., FLU_TILE_NZ) so that the data produced by one stage are still in cache when
+// consumed by the next stage
+// --> require LR_PENCIL, which restricts the data reconstruction to a range of z-slabs
+// --> do not support MHD since the CT update requires the fluxes of the entire patch group
+#if ( defined LR_PENCIL  &&  !defined GPU )
+#  define FLU_TILE
+#endif
+
+
 // verify that the density and pressure in the intermediate states of Roe's Riemann solver are positive.
 // --> if either is negative, we switch to other Riemann solvers (EXACT/HLLE/HLLC/HLLD)
 #if (  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  ( RSOLVER == ROE || RSOLVER_RESCUE == ROE )  )
@@ -245,6 +278,24 @@
 #  define HLLD_WAVESPEED   HLL_WAVESPEED_DAVIS
 
 
+// CPU only: solve the Riemann problems of a row of N_RSOLVER_ROW interfaces at once in Hydro_ComputeFlux()
+// --> the batched solvers (e.g., Hydro_RiemannSolver_HLLC_Row()) store data in the SoA form and are written
+//     branch-free so that compilers can vectorize them for the target instruction set (e.g., SSE/AVX2/AVX-512)
+// --> only support HLLC/HLLE with HLL_WAVESPEED_DAVIS and EOS_GAMMA in pure hydro for now
+//     --> all other configurations fall back to the per-interface Riemann solvers
+// --> comment out this line to disable it
+#  define RSOLVER_ROW
+
+#  define N_RSOLVER_ROW    64
+
+#if (  defined RSOLVER_ROW  &&  \
+       ( defined __CUDACC__  ||  defined MHD  ||  defined CHECK_UNPHYSICAL_IN_FLUID  ||  EOS != EOS_GAMMA  ||  \
+         !( (RSOLVER == HLLC && HLLC_WAVESPEED == HLL_WAVESPEED_DAVIS) || \
+            (RSOLVER == HLLE && HLLE_WAVESPEED == HLL_WAVESPEED_DAVIS) ) )  )
+#  undef RSOLVER_ROW
+#endif
+
+
 // 2. ELBDM macro
 //=========================================================================================
 #elif ( MODEL == ELBDM )
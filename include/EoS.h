@@ -45,4 +45,158 @@ struct EoS_t
 
 
 
+// compile-time specialization of the built-in EoSes with closed-form expressions
+// --> for EOS_GAMMA and EOS_ISOTHERMAL, the EOS_* macros below evaluate the EoS by the inline functions
+//     EoS_*_Inline() instead of calling the EoS routines through function pointers so that compilers
+//     can inline and vectorize the fluid and source-term solvers
+//     --> these inline functions must be consistent with src/EoS/Gamma and src/EoS/Isothermal
+// --> all other EoSes (e.g., EOS_USER and tabulated EoSes) still call the EoS routines via function pointers
+// --> disabled in the debug mode to keep the sanity checks in the EoS routines
+// --> usage: replace "EoS_DensEint2Pres( Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table )" by
+//            "EOS_DENSEINT2PRES( EoS_DensEint2Pres, Dens, Eint, Passive, AuxArray_Flt, AuxArray_Int, Table )"
+#if (  MODEL == HYDRO  &&  ( EOS == EOS_GAMMA || EOS == EOS_ISOTHERMAL )  &&  !defined GAMER_DEBUG  )
+#  define EOS_INLINE
+#endif
+
+#ifdef EOS_INLINE
+
+#ifdef __CUDACC__
+#  define EOS_INLINE_FUNC   __forceinline__ __device__
+#else
+#  define EOS_INLINE_FUNC   inline
+#endif
+
+// the inline versions do not need the function pointer, passive scalars, and integer/table auxiliary arrays
+// --> still evaluate them as void expressions to avoid unused-variable warnings at the call sites
+#  define EOS_UNUSED_ARGS( FuncPtr, Passive, AuxInt, Table )   ( (void)(FuncPtr), (void)(Passive), (void)(AuxInt), (void)(Table) )
+
+#  define EOS_DENSEINT2PRES( FuncPtr, Dens, Eint, Passive, AuxFlt, AuxInt, Table )   \
+          ( EOS_UNUSED_ARGS( FuncPtr, Passive, AuxInt, Table ), EoS_DensEint2Pres_Inline( Dens, Eint, AuxFlt ) )
+#  define EOS_DENSPRES2EINT( FuncPtr, Dens, Pres, Passive, AuxFlt, AuxInt, Table )   \
+          ( EOS_UNUSED_ARGS( FuncPtr, Passive, AuxInt, Table ), EoS_DensPres2Eint_Inline( Dens, Pres, AuxFlt ) )
+#  define EOS_DENSPRES2CSQR( FuncPtr, Dens, Pres, Passive, AuxFlt, AuxInt, Table )   \
+          ( EOS_UNUSED_ARGS( FuncPtr, Passive, AuxInt, Table ), EoS_DensPres2CSqr_Inline( Dens, Pres, AuxFlt ) )
+#  define EOS_DENSEINT2TEMP( FuncPtr, Dens, Eint, Passive, AuxFlt, AuxInt, Table )   \
+          ( EOS_UNUSED_ARGS( FuncPtr, Passive, AuxInt, Table ), EoS_DensEint2Temp_Inline( Dens, Eint, AuxFlt ) )
+#  define EOS_DENSTEMP2PRES( FuncPtr, Dens, Temp, Passive, AuxFlt, AuxInt, Table )   \
+          ( EOS_UNUSED_ARGS( FuncPtr, Passive, AuxInt, Table ), EoS_DensTemp2Pres_Inline( Dens, Temp, AuxFlt ) )
+#  define EOS_DENSEINT2ENTR( FuncPtr, Dens, Eint, Passive, AuxFlt, AuxInt, Table )   \
+          ( EOS_UNUSED_ARGS( FuncPtr, Passive, AuxInt, Table ), EoS_DensEint2Entr_Inline( Dens, Eint, AuxFlt ) )
+
+#else
+
+#  define EOS_DENSEINT2PRES( FuncPtr, Dens, Eint, Passive, AuxFlt, AuxInt, Table )   FuncPtr( Dens, Eint, Passive, AuxFlt, AuxInt, Table )
+#  define EOS_DENSPRES2EINT( FuncPtr, Dens, Pres, Passive, AuxFlt, AuxInt, Table )   FuncPtr( Dens, Pres, Passive, AuxFlt, AuxInt, Table )
+#  define EOS_DENSPRES2CSQR( FuncPtr, Dens, Pres, Passive, AuxFlt, AuxInt, Table )   FuncPtr( Dens, Pres, Passive, AuxFlt, AuxInt, Table )
+#  define EOS_DENSEINT2TEMP( FuncPtr, Dens, Eint, Passive, AuxFlt, AuxInt, Table )   FuncPtr( Dens, Eint, Passive, AuxFlt, AuxInt, Table )
+#  define EOS_DENSTEMP2PRES( FuncPtr, Dens, Temp, Passive, AuxFlt, AuxInt, Table )   FuncPtr( Dens, Temp, Passive, AuxFlt, AuxInt, Table )
+#  define EOS_DENSEINT2ENTR( FuncPtr, Dens, Eint, Passive, AuxFlt, AuxInt, Table )   FuncPtr( Dens, Eint, Passive, AuxFlt, AuxInt, Table )
+
+#endif // #ifdef EOS_INLINE ... else ...
+
+
+
+#ifdef EOS_INLINE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Pres/DensPres2Eint/DensPres2CSqr/DensEint2Temp/DensTemp2Pres/DensEint2Entr_Inline
+// Description :  Inline versions of the EoS conversion functions of EOS_GAMMA and EOS_ISOTHERMAL
+//
+// Note        :  1. Invoked by the EOS_* macros when EOS_INLINE is on
+//                2. Must return exactly the same results as EoS_*_Gamma/Isothermal() in src/EoS
+//                   --> See EoS_SetAuxArray_Gamma/Isothermal() for the values stored in AuxArray_Flt[]
+//
+// Parameter   :  Dens         : Gas mass density
+//                Eint/Pres/.. : Gas internal energy density/pressure/temperature
+//                AuxArray_Flt : Floating-point auxiliary array
+//
+// Return      :  Gas pressure/internal energy density/sound speed squared/temperature/pressure/entropy
+//-------------------------------------------------------------------------------------------------------
+EOS_INLINE_FUNC
+static real EoS_DensEint2Pres_Inline( const real Dens, const real Eint, const double AuxArray_Flt[] )
+{
+   (void)Dens;  (void)Eint;   // not used by all EoS
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma_m1 = (real)AuxArray_Flt[1];
+   return Eint * Gamma_m1;
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Cs2 = AuxArray_Flt[0];
+   return Cs2*Dens;
+#  endif
+} // FUNCTION : EoS_DensEint2Pres_Inline
+
+EOS_INLINE_FUNC
+static real EoS_DensPres2Eint_Inline( const real Dens, const real Pres, const double AuxArray_Flt[] )
+{
+   (void)Dens;  (void)Pres;   // not used by all EoS
+
+#  if   ( EOS == EOS_GAMMA )
+   const real _Gamma_m1 = (real)AuxArray_Flt[2];
+   return Pres * _Gamma_m1;
+#  elif ( EOS == EOS_ISOTHERMAL )
+   return (real)1.0e4*Pres;
+#  endif
+} // FUNCTION : EoS_DensPres2Eint_Inline
+
+EOS_INLINE_FUNC
+static real EoS_DensPres2CSqr_Inline( const real Dens, const real Pres, const double AuxArray_Flt[] )
+{
+   (void)Dens;  (void)Pres;   // not used by all EoS
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma = (real)AuxArray_Flt[0];
+   return Gamma * Pres / Dens;
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Cs2 = AuxArray_Flt[0];
+   return Cs2;
+#  endif
+} // FUNCTION : EoS_DensPres2CSqr_Inline
+
+EOS_INLINE_FUNC
+static real EoS_DensEint2Temp_Inline( const real Dens, const real Eint, const double AuxArray_Flt[] )
+{
+   (void)Dens;  (void)Eint;   // not used by all EoS
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma_m1 = (real)AuxArray_Flt[1];
+   const real m_kB     = (real)AuxArray_Flt[4];
+   const real Pres     = Eint * Gamma_m1;
+   return m_kB * Pres / Dens;
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Temp = AuxArray_Flt[1];
+   return Temp;
+#  endif
+} // FUNCTION : EoS_DensEint2Temp_Inline
+
+EOS_INLINE_FUNC
+static real EoS_DensTemp2Pres_Inline( const real Dens, const real Temp, const double AuxArray_Flt[] )
+{
+   (void)Dens;  (void)Temp;   // not used by all EoS
+
+#  if   ( EOS == EOS_GAMMA )
+   const real _m_kB = (real)AuxArray_Flt[5];
+   return Temp * Dens * _m_kB;
+#  elif ( EOS == EOS_ISOTHERMAL )
+   const real Cs2 = AuxArray_Flt[0];
+   return Cs2*Dens;
+#  endif
+} // FUNCTION : EoS_DensTemp2Pres_Inline
+
+EOS_INLINE_FUNC
+static real EoS_DensEint2Entr_Inline( const real Dens, const real Eint, const double AuxArray_Flt[] )
+{
+   (void)Dens;  (void)Eint;   // not used by all EoS
+
+#  if   ( EOS == EOS_GAMMA )
+   const real Gamma_m1 = (real)AuxArray_Flt[1];
+   const real Pres     = Eint * Gamma_m1;
+   return Pres * POW( Dens, -Gamma_m1 );
+#  elif ( EOS == EOS_ISOTHERMAL )
+   return NULL_REAL;
+#  endif
+} // FUNCTION : EoS_DensEint2Entr_Inline
+#endif // #ifdef EOS_INLINE
+
+
+
 #endif // #ifndef __EOS__
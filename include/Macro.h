@@ -684,6 +684,18 @@
 #define PS1P1           ( PS1 + 1 )
 
 
+// maximum number of patches at each level
+// --> the patch table grows on demand (see PatchTable_t in AMR.h), so it no longer needs to be set in the Makefile
+// --> it only serves as an optional upper limit and is still recorded in the output files
+#ifndef MAX_PATCH
+#  define MAX_PATCH     __INT_MAX__
+#endif
+
+// number of patch pointers in each chunk of the patch table (PATCH_TABLE_CHUNK = 2^PATCH_TABLE_CHUNK_BIT)
+#define PATCH_TABLE_CHUNK_BIT    12
+#define PATCH_TABLE_CHUNK        ( 1 << PATCH_TABLE_CHUNK_BIT )
+
+
 // size of GPU arrays (in one dimension)
 //###REVISE: support interpolation schemes requiring 2 ghost cells on each side for POT_NXT
 #  define FLU_NXT       ( PS2 + 2*FLU_GHOST_SIZE )                // use patch group as the unit
@@ -730,7 +742,8 @@
 #  define SRC_NAUX_DLEP          5     // SrcTerms.Dlep_AuxArray_Flt/Int[]
 #  define SRC_DLEP_PROF_NVAR     6     // SrcTerms.Dlep_Profile_DataDevPtr[]/RadiusDevPtr[]
 #  define SRC_DLEP_PROF_NBINMAX  4000
-#  define SRC_NAUX_EC            10     // SrcTerms.EC_AuxArray_Flt/Int[]
+#  define SRC_NAUX_EC            20     // SrcTerms.EC_AuxArray_Flt/Int[]
+#  define SRC_EC_TEF_NCOEFF      4     // SrcTerms.EC_TEF_Coeff_DevPtr[] (per-interval coefficients of the TEF)
 #else
 #  define SRC_NAUX_DLEP          0
 #  define SRC_NAUX_EC            0
@@ -16,6 +16,9 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 void Aux_Message( FILE *Type, const char *Format, ... );
 ulong Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
 long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
+void *PatchArena_Alloc( const size_t Size );
+void *PatchArena_AllocGroup( const size_t Size, const int LocalID, const int Sg );
+void  PatchArena_Free( void *Ptr );
 
 
 
@@ -535,11 +538,13 @@ struct patch_t
 #     endif
 #     endif
 
-      flux      [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
+      const size_t Size = NFLUX_TOTAL*SQR(PS1)*sizeof(real);
+
+      flux      [SibID]  = (real (*)[PS1][PS1])PatchArena_Alloc( Size );
       if ( AllocTmp )
-      flux_tmp  [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
+      flux_tmp  [SibID]  = (real (*)[PS1][PS1])PatchArena_Alloc( Size );
 #     ifdef BIT_REP_FLUX
-      flux_bitrep[SibID] = new real [NFLUX_TOTAL][PS1][PS1];
+      flux_bitrep[SibID] = (real (*)[PS1][PS1])PatchArena_Alloc( Size );
 #     endif
 
       for(int v=0; v<NFLUX_TOTAL; v++)
@@ -570,14 +575,14 @@ struct patch_t
 
       for (int s=0; s<6; s++)
       {
-         delete [] flux[s];
+         PatchArena_Free( flux[s] );
          flux[s] = NULL;
 
-         delete [] flux_tmp[s];
+         PatchArena_Free( flux_tmp[s] );
          flux_tmp[s] = NULL;
 
 #        ifdef BIT_REP_FLUX
-         delete [] flux_bitrep[s];
+         PatchArena_Free( flux_bitrep[s] );
          flux_bitrep[s] = NULL;
 #        endif
       }
@@ -617,11 +622,11 @@ struct patch_t
 
       const int Size = ( SibID < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
 
-      electric      [SibID]  = new real [Size];
+      electric      [SibID]  = (real*)PatchArena_Alloc( Size*sizeof(real) );
       if ( AllocTmp )
-      electric_tmp  [SibID]  = new real [Size];
+      electric_tmp  [SibID]  = (real*)PatchArena_Alloc( Size*sizeof(real) );
 #     ifdef BIT_REP_ELECTRIC
-      electric_bitrep[SibID] = new real [Size];
+      electric_bitrep[SibID] = (real*)PatchArena_Alloc( Size*sizeof(real) );
 #     endif
 
       for(int t=0; t<Size; t++)
@@ -650,14 +655,14 @@ struct patch_t
 
       for (int s=0; s<18; s++)
       {
-         delete [] electric[s];
+         PatchArena_Free( electric[s] );
          electric[s] = NULL;
 
-         delete [] electric_tmp[s];
+         PatchArena_Free( electric_tmp[s] );
          electric_tmp[s] = NULL;
 
 #        ifdef BIT_REP_ELECTRIC
-         delete [] electric_bitrep[s];
+         PatchArena_Free( electric_bitrep[s] );
          electric_bitrep[s] = NULL;
 #        endif
       }
@@ -671,14 +676,24 @@ struct patch_t
    // Method      :  hnew
    // Description :  Allocate fluid[]
    //
-   // Note        :  Do nothing if fluid[] has been allocated
+   // Note        :  1. Do nothing if fluid[] has been allocated
+   //                2. LocalID >= 0 --> allocate fluid[] as a slice of a block shared by the patch group in
+   //                   the sandglass Sg so that the fluid data of a patch group are contiguous
+   //                   --> See PatchArena_AllocGroup()
+   //
+   // Parameter   :  LocalID : Local index of the patch in its patch group (0 ~ 7)
+   //                          --> Negative for allocating fluid[] individually
+   //                Sg      : Sandglass of the patch (useless if LocalID < 0)
    //===================================================================================
-   void hnew()
+   void hnew( const int LocalID=-1, const int Sg=0 )
    {
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
+         const size_t Size = NCOMP_TOTAL*CUBE(PS1)*sizeof(real);
+
+         if ( LocalID < 0 )   fluid = (real (*)[PS1][PS1][PS1])PatchArena_Alloc( Size );
+         else                 fluid = (real (*)[PS1][PS1][PS1])PatchArena_AllocGroup( Size, LocalID, Sg );
          fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -693,11 +708,11 @@ struct patch_t
    void hdelete()
    {
 
-      delete [] fluid;
+      PatchArena_Free( fluid );
       fluid = NULL;
 
 #     ifdef MASSIVE_PARTICLES
-      delete [] rho_ext;
+      PatchArena_Free( rho_ext );
       rho_ext = NULL;
 #     endif
 
@@ -717,7 +732,7 @@ struct patch_t
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+         magnetic = (real (*)[ PS1P1*SQR(PS1) ])PatchArena_Alloc( NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
          magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -732,7 +747,7 @@ struct patch_t
    void mdelete()
    {
 
-      delete [] magnetic;
+      PatchArena_Free( magnetic );
       magnetic = NULL;
 
    } // METHOD : mdelete
@@ -750,10 +765,10 @@ struct patch_t
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      if ( pot == NULL )      pot     = (real (*)[PS1][PS1])PatchArena_Alloc( CUBE(PS1)*sizeof(real) );
 
 #     ifdef STORE_POT_GHOST
-      if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      if ( pot_ext == NULL )  pot_ext = (real (*)[GRA_NXT][GRA_NXT])PatchArena_Alloc( CUBE(GRA_NXT)*sizeof(real) );
 
 //    always initialize pot_ext[] (even if pot_ext != NULL when calling this function) to indicate that this array
 //    has NOT been properly set --> used by Poi_StorePotWithGhostZone()
@@ -771,11 +786,11 @@ struct patch_t
    void gdelete()
    {
 
-      delete [] pot;
+      PatchArena_Free( pot );
       pot = NULL;
 
 #     ifdef STORE_POT_GHOST
-      delete [] pot_ext;
+      PatchArena_Free( pot_ext );
       pot_ext = NULL;
 #     endif
 
@@ -796,7 +811,7 @@ struct patch_t
 
       if ( de_status == NULL )
       {
-         de_status = new char [PS1][PS1][PS1];
+         de_status = (char (*)[PS1][PS1])PatchArena_Alloc( CUBE(PS1)*sizeof(char) );
       }
 
    } // METHOD : snew
@@ -810,7 +825,7 @@ struct patch_t
    void sdelete()
    {
 
-      delete [] de_status;
+      PatchArena_Free( de_status );
       de_status = NULL;
 
    } // METHOD : sdelete
@@ -829,7 +844,7 @@ struct patch_t
    void dnew()
    {
 
-      if ( rho_ext == NULL )  rho_ext = new real [RHOEXT_NXT][RHOEXT_NXT][RHOEXT_NXT];
+      if ( rho_ext == NULL )  rho_ext = (real (*)[RHOEXT_NXT][RHOEXT_NXT])PatchArena_Alloc( CUBE(RHOEXT_NXT)*sizeof(real) );
 
 //    always initialize rho_ext (even if rho_ext != NULL when calling this function) to indicate that this array
 //    has NOT been properly set --> used by Prepare_PatchData()
@@ -846,7 +861,7 @@ struct patch_t
    void ddelete()
    {
 
-      delete [] rho_ext;
+      PatchArena_Free( rho_ext );
       rho_ext = NULL;
 
    } // METHOD : ddelete
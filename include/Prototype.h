@@ -81,9 +81,11 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
                       const double h_Corner_Array[][3],
                       const real h_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
+                      real h_PriVar_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const int NPatchGroup, const real dt, const real dh,
                       const bool StoreFlux, const bool StoreElectric,
                       const bool XYZ, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const int MinMod_MaxIter,
+                      const bool MinMod_LocalFallback, const int Tile_NZ,
                       const real ELBDM_Eta, real ELBDM_Taylor3_Coeff, const bool ELBDM_Taylor3_Auto,
                       const double Time, const bool UsePot, const OptExtAcc_t ExtAcc,
                       const real MinDens, const real MinPres, const real MinEint,
@@ -139,12 +141,13 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 const int NPG, const int *PID0_List,
                 const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                 const real h_Mag_Array_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                const double dt );
+                const double dt, const double TimeNew, const double TimeOld );
 void Flu_Prepare( const int lv, const double PrepTime,
                   real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                   real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                   real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
-                  double h_Corner_Array_F[][3], const int NPG, const int *PID0_List );
+                  double h_Corner_Array_F[][3],
+                  real h_PriVar_F_In[][FLU_NIN][ CUBE(FLU_NXT) ], const int NPG, const int *PID0_List );
 void Flu_FixUp_Flux( const int lv );
 void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg, const int SonMagSg, const int FaMagSg,
                          const int SonPotSg, const int FaPotSg, const long TVarCC, const long TVarFC );
@@ -178,7 +181,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                         const int GhostSize, const int NPG, const int *PID0_List, long TVarCC, long TVarFC,
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
                         const NSide_t NSide, const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
-                        const real MinDens, const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency );
+                        const real MinDens, const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency,
+                        real *OutputPri = NULL );
 
 
 // Init
@@ -256,6 +260,10 @@ double Mis_Cell2PhySize( const int NCell, const int lv );
 int    Mis_Scale2Cell( const int Scale, const int lv );
 int    Mis_Cell2Scale( const int NCell, const int lv );
 double dt_InvokeSolver( const Solver_t TSolver, const int lv );
+void   dt_Prefetch( const Solver_t TSolver, const int lv );
+void   PatchArena_Init();
+void   PatchArena_Shrink();
+void   PatchArena_End();
 void   dt_Prepare_Flu( const int lv, real h_Flu_Array_T[][FLU_NIN_T][ CUBE(PS1) ],
                        real h_Mag_Array_T[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const int NPG, const int *PID0_List );
 #ifdef GRAVITY
@@ -322,10 +330,12 @@ bool Flag_Check( const int lv, const int PID, const int i, const int j, const in
                  const real Fluid[][PS1][PS1][PS1], const real Pot[][PS1][PS1], const real MagCC[][PS1][PS1][PS1],
                  const real Vel[][PS1][PS1][PS1], const real Pres[][PS1][PS1],
                  const real *Lohner_Var, const real *Lohner_Ave, const real *Lohner_Slope, const int Lohner_NVar,
-                 const real ParCount[][PS1][PS1], const real ParDens[][PS1][PS1], const real JeansCoeff );
+                 const real ParCount[][PS1][PS1], const real ParDens[][PS1][PS1], const real JeansCoeff,
+                 const real TCoolTffCoeff );
 bool Flag_Lohner( const int i, const int j, const int k, const OptLohnerForm_t Form, const real *Var1D, const real *Ave1D,
                   const real *Slope1D, const int NVar, const double Threshold, const double Filter, const double Soften );
 void Refine( const int lv, const UseLBFunc_t UseLBFunc );
+long Refine_CountChange( const int lv, const UseLBFunc_t UseLBFunc );
 void SiblingSearch( const int lv );
 void SiblingSearch_Base();
 #ifndef SERIAL
@@ -717,6 +727,12 @@ void Src_Prepare( const int lv, const double PrepTime,
 void Src_Close( const int lv, const int SaveSg_Flu, const real h_Flu_Array_S_Out[][FLU_NOUT_S][ CUBE(PS1) ],
                 const int NPG, const int *PID0_List );
 void Src_WorkBeforeMajorFunc( const int lv, const double TimeNew, const double TimeOld, const double dt );
+void Src_BeginFusedUpdate( const int lv, const double TimeNew, const double TimeOld, const double dt );
+void Src_EndFusedUpdate( const int lv, const double TimeNew, const int SaveSg_Flu );
+void Src_ValidateTCool_ExactCooling( const int lv, const int Sg, const double Time );
+void Src_InvalidateTCool_ExactCooling( const int lv );
+bool Src_IsValidTCool_ExactCooling( const int lv );
+void Src_UpdateTCool_ExactCooling( const int lv );
 void CPU_SrcSolver( const real h_Flu_Array_In [][FLU_NIN_S ][ CUBE(SRC_NXT)           ],
                           real h_Flu_Array_Out[][FLU_NOUT_S][ CUBE(PS1)               ],
                     const real h_Mag_Array_In [][NCOMP_MAG ][ SRC_NXT_P1*SQR(SRC_NXT) ],
@@ -724,6 +740,10 @@ void CPU_SrcSolver( const real h_Flu_Array_In [][FLU_NIN_S ][ CUBE(SRC_NXT)
                     const SrcTerms_t SrcTerms, const int NPatchGroup, const real dt, const real dh,
                     const double TimeNew, const double TimeOld,
                     const real MinDens, const real MinPres, const real MinEint );
+void CPU_SrcSolver_AdvanceCell( real fluid[], const real B[], const SrcTerms_t *SrcTerms,
+                                const real dt, const real dh, const double x, const double y, const double z,
+                                const double TimeNew, const double TimeOld,
+                                const real MinDens, const real MinPres, const real MinEint, const EoS_t *EoS );
 
 
 // Grackle
@@ -28,6 +28,11 @@ typedef void (*SrcFunc_t)( real fluid[], const real B[],
 //                Deleptonization           : SRC_DELEPTONIZATION
 //                ExactCooling              : SRC_EXACTCOOLING
 //                User                      : SRC_USER
+//                SubcycleTol               : Relative error tolerance of the adaptive subcycling of the non-exact
+//                                            source terms on each cell (<= 0.0 --> disable subcycling)
+//                SubcycleMaxNSub           : Maximum number of subcycling trials on each cell
+//                FuseFluid                 : Apply the source terms in Flu_Close() right after the fluid solver
+//                                            instead of in a separate source-term solver (CPU only)
 //                BoxCenter                 : Simulation box center
 //                Unit_*                    : Code units
 //                *_FuncPtr                 : Major source-term functions
@@ -40,6 +45,17 @@ typedef void (*SrcFunc_t)( real fluid[], const real B[],
 //                                            --> For GPU, Dlep_Profile_DataDevPtr[]/RadiusDevPtr[] store the
 //                                                addresses of global memory arrays, which should NOT be used by host
 //                Dlep_Profile_NBin         : Number of radial bins in Dlep_Profile_*
+//                EC_TEF_N                  : Number of sampling points of the temporal evolution function (TEF)
+//                EC_X                      : Hydrogen mass fraction assumed by ExactCooling
+//                EC_Z                      : Metallicity assumed by ExactCooling
+//                EC_NZ                     : Number of TEF tables sampled in metallicity by ExactCooling
+//                                            --> EC_NZ > 1 : use the metallicity of each cell stored in Idx_Metal
+//                EC_ZMin/ZMax              : Metallicity range of the EC_NZ TEF tables
+//                EC_MixedPrecision         : Evaluate the TEF tables in single precision and accumulate the TEF in
+//                                            double precision in CPU_SrcSolver_ExactCooling()
+//                EC_TEF_*_DevPtr           : TEF tables used by ExactCooling
+//                                            --> EC_TEF_Coeff_DevPtr[] stores SRC_EC_TEF_NCOEFF precomputed
+//                                                coefficients for each interval (see Src_Init_ExactCooling())
 //
 // Method      :  None --> It seems that CUDA does not support functions in a struct
 //-------------------------------------------------------------------------------------------------------
@@ -50,6 +66,9 @@ struct SrcTerms_t
    bool   Deleptonization;
    bool   ExactCooling;
    bool   User;
+   double SubcycleTol;
+   int    SubcycleMaxNSub;
+   bool   FuseFluid;
 
    double BoxCenter[3];
 
@@ -88,9 +107,16 @@ struct SrcTerms_t
    double   *EC_AuxArrayDevPtr_Flt;
    int      *EC_AuxArrayDevPtr_Int;
    int       EC_TEF_N;
+   double    EC_X;
+   double    EC_Z;
+   int       EC_NZ;
+   double    EC_ZMin;
+   double    EC_ZMax;
+   int       EC_MixedPrecision;
    double   *EC_TEF_lambda_DevPtr;
    double   *EC_TEF_alpha_DevPtr;
    double   *EC_TEFc_DevPtr;
+   double   *EC_TEF_Coeff_DevPtr;
 #  endif
 
 // user-specified source term
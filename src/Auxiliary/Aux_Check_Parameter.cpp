@@ -158,6 +158,10 @@ void Aux_Check_Parameter()
    if ( OPT__OVERLAP_MPI )
       Aux_Error( ERROR_INFO, "\"%s\" is NOT supported yet !!\n", "OPT__OVERLAP_MPI" );
 
+   if (  OPT__PIPELINE_SOLVER  &&  ( PIPELINE_NTHREAD < 1 || PIPELINE_NTHREAD >= OMP_NTHREAD )  )
+      Aux_Error( ERROR_INFO, "PIPELINE_NTHREAD (%d) must be in the range [1, OMP_NTHREAD-1] (OMP_NTHREAD = %d) !!\n",
+                 PIPELINE_NTHREAD, OMP_NTHREAD );
+
    if ( AUTO_REDUCE_DT )
    {
       if ( OPT__OVERLAP_MPI )
@@ -337,6 +341,7 @@ void Aux_Check_Parameter()
    Flag |= OPT__FLAG_PRES_GRADIENT;
    Flag |= OPT__FLAG_VORTICITY;
    Flag |= OPT__FLAG_JEANS;
+   Flag |= OPT__FLAG_TCOOL_TFF;
    Flag |= OPT__FLAG_LOHNER_ENGY;
    Flag |= OPT__FLAG_LOHNER_PRES;
    Flag |= OPT__FLAG_LOHNER_TEMP;
@@ -1451,6 +1456,18 @@ void Aux_Check_Parameter()
 // ------------------------------
    if ( MPI_Rank == 0 ) {
 
+   if ( SrcTerms.SubcycleTol > 0.0  &&  !SrcTerms.Deleptonization  &&  !SrcTerms.User )
+      Aux_Message( stderr, "WARNING : SRC_SUBCYCLE_TOL (%13.7e) is useless since only the exact cooling is enabled !!\n",
+                   SrcTerms.SubcycleTol );
+
+#  ifdef FLOAT8
+   if ( SrcTerms.SubcycleTol > 0.0  &&  SrcTerms.SubcycleTol < 1.0e2*__DBL_EPSILON__ )
+#  else
+   if ( SrcTerms.SubcycleTol > 0.0  &&  SrcTerms.SubcycleTol < 1.0e2*__FLT_EPSILON__ )
+#  endif
+      Aux_Message( stderr, "WARNING : SRC_SUBCYCLE_TOL (%13.7e) is close to the round-off errors !!\n",
+                   SrcTerms.SubcycleTol );
+
    } // if ( MPI_Rank == 0 )
 
 
@@ -850,6 +850,7 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "REGRID_COUNT                    %d\n",      REGRID_COUNT              );
       fprintf( Note, "REFINE_NLEVEL                   %d\n",      REFINE_NLEVEL             );
+      fprintf( Note, "OPT__REGRID_SKIP_UNCHANGED      %d\n",      OPT__REGRID_SKIP_UNCHANGED);
       fprintf( Note, "FLAG_BUFFER_SIZE                %d\n",      FLAG_BUFFER_SIZE          );
       fprintf( Note, "FLAG_BUFFER_SIZE_MAXM1_LV       %d\n",      FLAG_BUFFER_SIZE_MAXM1_LV );
       fprintf( Note, "FLAG_BUFFER_SIZE_MAXM2_LV       %d\n",      FLAG_BUFFER_SIZE_MAXM2_LV );
@@ -860,6 +861,7 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__FLAG_PRES_GRADIENT         %d\n",      OPT__FLAG_PRES_GRADIENT   );
       fprintf( Note, "OPT__FLAG_VORTICITY             %d\n",      OPT__FLAG_VORTICITY       );
       fprintf( Note, "OPT__FLAG_JEANS                 %d\n",      OPT__FLAG_JEANS           );
+      fprintf( Note, "OPT__FLAG_TCOOL_TFF             %d\n",      OPT__FLAG_TCOOL_TFF       );
 #     ifdef MHD
       fprintf( Note, "OPT__FLAG_CURRENT               %d\n",      OPT__FLAG_CURRENT         );
 #     endif
@@ -894,6 +896,7 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__REUSE_MEMORY               %d\n",      OPT__REUSE_MEMORY         );
       fprintf( Note, "OPT__MEMORY_POOL                %d\n",      OPT__MEMORY_POOL          );
+      fprintf( Note, "OPT__PATCH_ARENA                %d\n",      OPT__PATCH_ARENA          );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 
@@ -930,8 +933,19 @@ void Aux_TakeNote()
       fprintf( Note, "SRC_DELEPTONIZATION             %d\n",      SrcTerms.Deleptonization  );
       fprintf( Note, "SRC_EXACTCOOLING                %d\n",      SrcTerms.ExactCooling     );
       if ( SrcTerms.ExactCooling ) {
-      fprintf( Note, "SRC_EC_TEF_N                    %d\n",      SrcTerms.EC_TEF_N         ); }
+      fprintf( Note, "SRC_EC_TEF_N                    %d\n",      SrcTerms.EC_TEF_N         );
+      fprintf( Note, "SRC_EC_X                        %13.7e\n", SrcTerms.EC_X             );
+      fprintf( Note, "SRC_EC_Z                        %13.7e\n", SrcTerms.EC_Z             );
+      fprintf( Note, "SRC_EC_NZ                       %d\n",      SrcTerms.EC_NZ            );
+      fprintf( Note, "SRC_EC_ZMIN                     %13.7e\n", SrcTerms.EC_ZMin          );
+      fprintf( Note, "SRC_EC_ZMAX                     %13.7e\n", SrcTerms.EC_ZMax          );
+      fprintf( Note, "SRC_EC_MIXED_PRECISION          %d\n",      SrcTerms.EC_MixedPrecision );
+      fprintf( Note, "SRC_EC_TABLE                    %s\n",      SRC_EC_TABLE              );
+      fprintf( Note, "SRC_EC_TEF_CACHE                %s\n",      SRC_EC_TEF_CACHE          ); }
       fprintf( Note, "SRC_USER                        %d\n",      SrcTerms.User             );
+      fprintf( Note, "SRC_SUBCYCLE_TOL                %13.7e\n", SrcTerms.SubcycleTol      );
+      fprintf( Note, "SRC_SUBCYCLE_MAX_NSUB           %d\n",      SrcTerms.SubcycleMaxNSub  );
+      fprintf( Note, "SRC_FUSE_FLUID                  %d\n",      SrcTerms.FuseFluid        );
       fprintf( Note, "SRC_GPU_NPGROUP                 %d\n",      SRC_GPU_NPGROUP           );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -1004,6 +1018,9 @@ void Aux_TakeNote()
       fprintf( Note, "ISO_TEMP                        %13.7e\n",  ISO_TEMP                );
       fprintf( Note, "MINMOD_COEFF                    %13.7e\n",  MINMOD_COEFF            );
       fprintf( Note, "MINMOD_MAX_ITER                 %d\n",      MINMOD_MAX_ITER         );
+      fprintf( Note, "MINMOD_LOCAL_FALLBACK           %d\n",      MINMOD_LOCAL_FALLBACK   );
+      fprintf( Note, "OPT__FLU_PREP_PRI               %d\n",      OPT__FLU_PREP_PRI       );
+      fprintf( Note, "FLU_TILE_NZ                     %d\n",      FLU_TILE_NZ             );
       fprintf( Note, "OPT__LR_LIMITER                 %s\n",      ( OPT__LR_LIMITER == LR_LIMITER_VANLEER    ) ? "VANLEER"    :
                                                                   ( OPT__LR_LIMITER == LR_LIMITER_GMINMOD    ) ? "GMINMOD"    :
                                                                   ( OPT__LR_LIMITER == LR_LIMITER_ALBADA     ) ? "ALBADA"     :
@@ -1070,6 +1087,10 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "FLU_GPU_NPGROUP                 %d\n",      FLU_GPU_NPGROUP          );
       fprintf( Note, "GPU_NSTREAM                     %d\n",      GPU_NSTREAM              );
+      fprintf( Note, "OPT__PIPELINE_SOLVER            %d\n",      OPT__PIPELINE_SOLVER     );
+      fprintf( Note, "PIPELINE_NTHREAD                %d\n",      PIPELINE_NTHREAD         );
+      fprintf( Note, "OPT__AUTO_NPGROUP               %d\n",      OPT__AUTO_NPGROUP        );
+      fprintf( Note, "OPT__CONCURRENT_DT              %d\n",      OPT__CONCURRENT_DT       );
       fprintf( Note, "OPT__FIXUP_FLUX                 %d\n",      OPT__FIXUP_FLUX          );
 #     ifdef MHD
       fprintf( Note, "OPT__FIXUP_ELECTRIC             %d\n",      OPT__FIXUP_ELECTRIC      );
@@ -1488,6 +1509,16 @@ void Aux_TakeNote()
          fprintf( Note, "\n\n");
       }
 
+      if ( OPT__FLAG_TCOOL_TFF )
+      {
+         fprintf( Note, "Flag Criterion (Cooling Time over Free-fall Time in HYDRO)\n" );
+         fprintf( Note, "***********************************************************************************\n" );
+         fprintf( Note, "  Level       t_cool / t_ff\n" );
+         for (int lv=0; lv<MAX_LEVEL; lv++)  fprintf( Note, "%7d%20.7e\n", lv, FlagTable_TCoolTff[lv] );
+         fprintf( Note, "***********************************************************************************\n" );
+         fprintf( Note, "\n\n");
+      }
+
 #     ifdef MHD
       if ( OPT__FLAG_CURRENT )
       {
@@ -20,6 +20,10 @@
    I.   Set EoS auxiliary arrays
    II.  Implement EoS conversion functions
    III. Set EoS initialization functions
+
+4. The solvers evaluate this EoS by the inline functions EoS_*_Inline() in EoS.h
+   instead when EOS_INLINE is on
+   --> Any change to the conversion functions here must be applied there as well
 ********************************************************/
 
 
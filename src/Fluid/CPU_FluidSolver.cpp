@@ -34,6 +34,7 @@ void CPU_FluidSolver_MHM(
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
          real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
+         real   g_PriVar_In    []   [NCOMP_TOTAL         ][ CUBE(FLU_NXT) ],
          real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
          real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
          real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
@@ -42,7 +43,8 @@ void CPU_FluidSolver_MHM(
    const int NPatchGroup,
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
-   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const int MinMod_MaxIter, const double Time,
+   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const int MinMod_MaxIter,
+   const bool MinMod_LocalFallback, const int Tile_NZ, const double Time,
    const bool UsePot, const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func,
    const double c_ExtAcc_AuxArray[],
    const real MinDens, const real MinPres, const real MinEint,
@@ -131,6 +133,9 @@ static real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ] = NULL;
 //                h_Ele_Array         : Host array to store the output electric field (for MHD only)
 //                h_Corner_Array      : Host array storing the physical corner coordinates of each patch group
 //                h_Pot_Array_USG     : Host array storing the input potential for UNSPLIT_GRAVITY
+//                h_PriVar_In         : Host array storing the input primitive variables prepared by Flu_Prepare()
+//                                      --> For OPT__FLU_PREP_PRI only (i.e., MHM); NULL --> convert h_Flu_Array_In[]
+//                                          to primitive variables in the solver
 //                NPatchGroup         : Number of patch groups to be evaluated
 //                dt                  : Time interval to advance solution
 //                dh                  : Grid size
@@ -144,6 +149,10 @@ static real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ] = NULL;
 //                                                     vanLeer + generalized MinMod/extrema-preserving) limiter
 //                MinMod_Coeff        : Coefficient of the generalized MinMod limiter
 //                MinMod_MaxIter      : Maximum number of iterations to reduce MinMod_Coeff
+//                MinMod_LocalFallback: true --> recompute only the fluxes of the failed cells instead of
+//                                      reducing MinMod_Coeff for the entire patch group (MHM/MHM_RP only)
+//                Tile_NZ             : Number of z-slabs of each patch group advanced at a time (<=0: off)
+//                                      --> See FLU_TILE in CUFLU.h (MHM/MHM_RP only)
 //                ELBDM_Eta           : Particle mass / Planck constant
 //                ELBDM_Taylor3_Coeff : Coefficient in front of the third term in the Taylor expansion for ELBDM
 //                ELBDM_Taylor3_Auto  : true --> Determine ELBDM_Taylor3_Coeff automatically by invoking the
@@ -176,9 +185,11 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
                       const double h_Corner_Array[][3],
                       const real h_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
+                      real h_PriVar_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const int NPatchGroup, const real dt, const real dh,
                       const bool StoreFlux, const bool StoreElectric,
                       const bool XYZ, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const int MinMod_MaxIter,
+                      const bool MinMod_LocalFallback, const int Tile_NZ,
                       const real ELBDM_Eta, real ELBDM_Taylor3_Coeff, const bool ELBDM_Taylor3_Auto,
                       const double Time, const bool UsePot, const OptExtAcc_t ExtAcc,
                       const real MinDens, const real MinPres, const real MinEint,
@@ -215,9 +226,9 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
 
       CPU_FluidSolver_MHM ( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, h_Mag_Array_Out,
                             h_DE_Array_Out, h_Flux_Array, h_Ele_Array, h_Corner_Array, h_Pot_Array_USG,
-                            h_PriVar, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
-                            NPatchGroup, dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, MinMod_MaxIter, Time,
-                            UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
+                            h_PriVar, h_PriVar_In, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
+                            NPatchGroup, dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, MinMod_MaxIter,
+                            MinMod_LocalFallback, Tile_NZ, Time, UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
                             DualEnergySwitch, NormPassive, NNorm, NormIdx, FracPassive, NFrac, FracIdx,
                             JeansMinPres, JeansMinPres_Coeff, EoS );
 
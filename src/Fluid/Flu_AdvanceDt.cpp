@@ -9,6 +9,8 @@ int FluStatus_ThisRank;
 void Flu_SwapFixUpTempArray( const int lv );
 void Flu_InitFixUpTempArray( const int lv );
 
+extern void (*Mis_UserWorkBeforeNextLevel_Ptr)( const int lv, const double TimeNew, const double TimeOld, const double dt );
+
 
 
 
@@ -19,6 +21,14 @@ void Flu_InitFixUpTempArray( const int lv );
 // Note        :  1. Invoke InvokeSolver()
 //                2. Currently the updated data can only be stored in the different sandglass from the
 //                   input data
+//                3. Also apply the local source terms if SRC_FUSE_FLUID is on (see Flu_Close())
+//                4. For OPT__CONCURRENT_DT, evaluate the CFL condition on lv+1 concurrently with the fluid solver
+//                   on lv (see dt_Prefetch())
+//                   --> It only depends on the fluid data on lv+1, which are not modified until lv+1 is advanced
+//                   --> Disabled when Mis_UserWorkBeforeNextLevel_Ptr is set since it may modify lv+1
+//                   --> Split the OpenMP threads between the two tasks according to the number of patch groups on lv
+//                   --> Disabled by Init_ResetParameter() when OPT__PIPELINE_SOLVER is on since Pipeline_Step()
+//                       assumes all OMP_NTHREAD threads are available
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -56,10 +66,60 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 #  endif
 
 
+// prepare the local source terms to be applied in Flu_Close()
+   if ( SrcTerms.FuseFluid )  Src_BeginFusedUpdate( lv, TimeNew, TimeOld, dt );
+
+
 // invoke the fluid solver
    FluStatus_ThisRank = GAMER_SUCCESS;
 
-   InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, OverlapMPI, Overlap_Sync );
+   const bool ConcurrentDt = ( OPT__CONCURRENT_DT  &&  !OverlapMPI  &&  lv < TOP_LEVEL  &&  NPatchTotal[lv+1] > 0  &&
+                             Mis_UserWorkBeforeNextLevel_Ptr == NULL );
+
+   if ( ConcurrentDt )
+   {
+#     ifdef OPENMP
+      const int NThread_Flu = MIN(  MAX( amr->NPatchComma[lv][1]/8, 1 ), OMP_NTHREAD-1  );
+      const int NThread_dt  = OMP_NTHREAD - NThread_Flu;
+
+      omp_set_nested( true );
+#     endif
+
+//    thread 0 is the master thread and must advance the fluid solver in case of MPI calls
+#     pragma omp parallel num_threads( 2 )
+      {
+#        ifdef OPENMP
+         const int TID = omp_get_thread_num();
+#        else
+         const int TID = 0;
+#        endif
+
+         if ( TID == 0 )
+         {
+#           ifdef OPENMP
+            omp_set_num_threads( NThread_Flu );
+#           endif
+
+            InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, OverlapMPI, Overlap_Sync );
+         }
+
+         else
+         {
+#           ifdef OPENMP
+            omp_set_num_threads( NThread_dt );
+#           endif
+
+            dt_Prefetch( DT_FLU_SOLVER, lv+1 );
+         }
+      } // OpenMP parallel region
+
+#     ifdef OPENMP
+      omp_set_nested( false );
+#     endif
+   } // if ( ConcurrentDt )
+
+   else
+      InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, OverlapMPI, Overlap_Sync );
 
 
 // collect the fluid solver status from all ranks (only necessary for AUTO_REDUCE_DT)
@@ -86,6 +146,10 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 
 //    swap the flux (and electric in MHD) pointers on the parent level if the fluid solver works successfully
       if ( AUTO_REDUCE_DT  &&  lv != 0 )  Flu_SwapFixUpTempArray( lv-1 );
+
+
+//    local source terms have been applied in Flu_Close()
+      if ( SrcTerms.FuseFluid )  Src_EndFusedUpdate( lv, TimeNew, SaveSg_Flu );
    }
 
 
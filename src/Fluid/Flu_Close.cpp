@@ -8,11 +8,16 @@ extern int FluStatus_ThisRank;
 // whether or not to continue applying AUTO_REDUCE_DT (decalred in Flu_AdvanceDt.cpp)
 extern bool AutoReduceDt_Continue;
 
+// minimum cooling time of the exact cooling (declared in Src_AdvanceDt.cpp)
+extern double tcool_min_for_solver[NLEVEL];
+
 
 static void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                        const int NPG, const int *PID0_List, const real dt );
 static void CorrectFlux( const int SonLv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                          const int NPG, const int *PID0_List, const real dt );
+static double AdvanceSrcTerms( const int lv, const int PID, const int SaveSg_Flu, const int SaveSg_Mag,
+                               const real dt, const double TimeNew, const double TimeOld );
 #if ( MODEL == HYDRO )
 static bool Unphysical( const real Fluid[], const int CheckMode, const real Emag );
 static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
@@ -59,6 +64,9 @@ extern void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real
 //                2. Correct the fluxes across the coarse-fine boundaries at level "lv-1"
 //                3. Copy the data from the "h_Flu_Array_F_Out" and "h_DE_Array_F_Out" arrays to the "amr->patch" pointers
 //                4. Get the minimum time-step information of the fluid solver
+//                5. Apply the local source terms to the updated data if SRC_FUSE_FLUID is on
+//                   --> Avoid preparing and storing the same data again in the separate source-term solver
+//                   --> Record the minimum cooling time in tcool_min_for_solver[lv] as Src_Close() does
 //
 // Parameter   :  lv                : Target refinement level
 //                SaveSg_Flu        : Sandglass to store the updated fluid data
@@ -73,6 +81,8 @@ extern void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real
 //                h_Flu_Array_F_In  : Host array storing the input fluid variables
 //                h_Mag_Array_F_In  : Host array storing the input B field (for MHD only)
 //                dt                : Evolution time-step
+//                TimeNew           : Target physical time to reach (for SRC_FUSE_FLUID only)
+//                TimeOld           : Physical time before update (for SRC_FUSE_FLUID only)
 //-------------------------------------------------------------------------------------------------------
 void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
@@ -83,7 +93,7 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 const int NPG, const int *PID0_List,
                 const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                 const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                const double dt )
+                const double dt, const double TimeNew, const double TimeOld )
 {
 
 // try to correct the unphysical results in h_Flu_Array_F_Out (e.g., negative density)
@@ -123,7 +133,10 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 #     error : ERROR : FLU_NOUT != NCOMP_TOTAL (one must specify how to copy data from h_Flu_Array_F_Out to fluid) !!
 #  endif
 
-#  pragma omp parallel for schedule( static )
+   const bool FuseSrc   = ( SrcTerms.Any  &&  SrcTerms.FuseFluid );
+   double     tcool_min = HUGE_NUMBER;
+
+#  pragma omp parallel for reduction( min:tcool_min ) schedule( static )
    for (int TID=0; TID<NPG; TID++)
    {
       const int PID0 = PID0_List[TID];
@@ -135,6 +148,15 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
          const int Table_y = TABLE_02( LocalID, 'y', 0, PATCH_SIZE );
          const int Table_z = TABLE_02( LocalID, 'z', 0, PATCH_SIZE );
 
+//       load the patch pointers once instead of looking up the patch table in every cell
+         real (*Fluid)[PS1][PS1][PS1] = amr->patch[SaveSg_Flu][lv][PID]->fluid;
+#        ifdef DUAL_ENERGY
+         char (*DE_Status)[PS1][PS1]  = amr->patch[0][lv][PID]->de_status;    // de_status is always stored in Sg=0
+#        endif
+#        ifdef MHD
+         real (*Magnetic)[ PS1P1*SQR(PS1) ] = amr->patch[SaveSg_Mag][lv][PID]->magnetic;
+#        endif
+
          int I, J, K, KJI;
 
 //       fluid variables
@@ -145,7 +167,7 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 
             KJI = IDX321( I, J, K, PS2, PS2 );
 
-            amr->patch[SaveSg_Flu][lv][PID]->fluid[v][k][j][i] = h_Flu_Array_F_Out[TID][v][KJI];
+            Fluid[v][k][j][i] = h_Flu_Array_F_Out[TID][v][KJI];
 
          }}}}
 
@@ -157,8 +179,7 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 
             KJI = IDX321( I, J, K, PS2, PS2 );
 
-//          de_status is always stored in Sg=0
-            amr->patch[0][lv][PID]->de_status[k][j][i] = h_DE_Array_F_Out[TID][KJI];
+            DE_Status[k][j][i] = h_DE_Array_F_Out[TID][KJI];
 
          }}}
 #        endif
@@ -177,19 +198,90 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 
                KJI = IDX321( I, J, K, ijk_end[0]+PS1, ijk_end[1]+PS1 );
 
-               amr->patch[SaveSg_Mag][lv][PID]->magnetic[v][ idx ++ ] = h_Mag_Array_F_Out[TID][v][KJI];
+               Magnetic[v][ idx ++ ] = h_Mag_Array_F_Out[TID][v][KJI];
 
             }}}
          } // for (int v=0; v<NCOMP_MAG; v++)
 #        endif // #ifdef MHD
 
+//       local source terms
+//       --> must be applied after storing the B field
+         if ( FuseSrc )
+            tcool_min = fmin( tcool_min, AdvanceSrcTerms(lv, PID, SaveSg_Flu, SaveSg_Mag, dt, TimeNew, TimeOld) );
+
       } // for (int LocalID=0; LocalID<8; LocalID++)
    } // for (int TID=0; TID<NPG; TID++)
 
+   if ( FuseSrc )    tcool_min_for_solver[lv] = fmin( tcool_min_for_solver[lv], tcool_min );
+
 } // FUNCTION : Flu_Close
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AdvanceSrcTerms
+// Description :  Apply all local source terms to a patch just updated by the fluid solver
+//
+// Note        :  1. Invoked by Flu_Close() when SRC_FUSE_FLUID is on
+//                   --> Work on the patch data while they are still in cache
+//                2. Equivalent to CPU_SrcSolver_IterateAllCells() but without Src_Prepare() and Src_Close()
+//                   --> Assume SRC_GHOST_SIZE == 0
+//                3. The source terms are applied before the gravity correction in this mode
+//
+// Parameter   :  lv         : Target refinement level
+//                PID        : Target patch index
+//                SaveSg_Flu : Sandglass storing the updated fluid data
+//                SaveSg_Mag : Sandglass storing the updated B field (for MHD only)
+//                dt         : Time interval to advance solution
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//
+// Return      :  fluid[] in the target patch and the minimum cooling time in it (HUGE_NUMBER if not applicable)
+//-------------------------------------------------------------------------------------------------------
+double AdvanceSrcTerms( const int lv, const int PID, const int SaveSg_Flu, const int SaveSg_Mag,
+                        const real dt, const double TimeNew, const double TimeOld )
+{
+
+#  if ( SRC_GHOST_SIZE != 0 )
+#     error : ERROR : SRC_FUSE_FLUID assumes SRC_GHOST_SIZE == 0 !!
+#  endif
+
+   const double  dh    = amr->dh[lv];
+   const double *EdgeL = amr->patch[0][lv][PID]->EdgeL;
+   real (*Fluid)[PS1][PS1][PS1] = amr->patch[SaveSg_Flu][lv][PID]->fluid;
+
+   double tcool_min = HUGE_NUMBER;
+
+   for (int k=0; k<PS1; k++)  {  const double z = EdgeL[2] + (k+0.5)*dh;
+   for (int j=0; j<PS1; j++)  {  const double y = EdgeL[1] + (j+0.5)*dh;
+   for (int i=0; i<PS1; i++)  {  const double x = EdgeL[0] + (i+0.5)*dh;
+
+#     ifdef MHD
+      real B[NCOMP_MAG];
+      MHD_GetCellCenteredBFieldInPatch( B, lv, PID, i, j, k, SaveSg_Mag );
+#     else
+      real *B = NULL;
+#     endif
+
+      real fluid[FLU_NIN_S];
+      for (int v=0; v<FLU_NIN_S; v++)  fluid[v] = Fluid[v][k][j][i];
+
+      CPU_SrcSolver_AdvanceCell( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld,
+                                 MIN_DENS, MIN_PRES, MIN_EINT, &EoS );
+
+      for (int v=0; v<FLU_NOUT_S; v++)  Fluid[v][k][j][i] = fluid[v];
+
+#     ifdef TCOOL
+      if ( SrcTerms.ExactCooling )  tcool_min = fmin( tcool_min, (double)fluid[TCOOL] );
+#     endif
+   }}} // i,j,k
+
+   return tcool_min;
+
+} // FUNCTION : AdvanceSrcTerms
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  StoreFlux
 // Description :  Save the coarse-grid fluxes across the coarse-fine boundaries for patches at level "lv"
@@ -296,6 +296,10 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
 #     endif // #ifdef MHD
 
 
+//    load the father fluid pointer once for the cell loops below
+      real (*FaFluid)[PS1][PS1][PS1] = amr->patch[FaFluSg][FaLv][FaPID]->fluid;
+
+
 //    check the minimum pressure/internal energy and, when the dual-energy formalism is adopted, ensure the consistency between
 //    pressure, total energy density, and the dual-energy variable
 #     if ( MODEL == HYDRO )
@@ -324,24 +328,24 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
          const real UseDual2FixEngy  = HUGE_NUMBER;
          char dummy;    // we do not record the dual-energy status here
 
-         Hydro_DualEnergyFix( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[DUAL][k][j][i],
+         Hydro_DualEnergyFix( FaFluid[DENS][k][j][i],
+                              FaFluid[MOMX][k][j][i],
+                              FaFluid[MOMY][k][j][i],
+                              FaFluid[MOMZ][k][j][i],
+                              FaFluid[ENGY][k][j][i],
+                              FaFluid[DUAL][k][j][i],
                               dummy, EoS_AuxArray_Flt[1], EoS_AuxArray_Flt[2], CheckMinPres_Yes, MIN_PRES,
                               UseDual2FixEngy, Emag );
 
 #        else // #ifdef DUAL_ENERGY
 
 //       actually it might not be necessary to check the minimum internal energy here
-         amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i]
-            = Hydro_CheckMinEintInEngy( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
-                                        amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
+         FaFluid[ENGY][k][j][i]
+            = Hydro_CheckMinEintInEngy( FaFluid[DENS][k][j][i],
+                                        FaFluid[MOMX][k][j][i],
+                                        FaFluid[MOMY][k][j][i],
+                                        FaFluid[MOMZ][k][j][i],
+                                        FaFluid[ENGY][k][j][i],
                                         MIN_EINT, Emag );
 #        endif // #ifdef DUAL_ENERGY ... else ...
       } // i,j,k
@@ -357,22 +361,22 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
       for (int j=0; j<PS1; j++)
       for (int i=0; i<PS1; i++)
       {
-         Real      = amr->patch[FaFluSg][FaLv][FaPID]->fluid[REAL][k][j][i];
-         Imag      = amr->patch[FaFluSg][FaLv][FaPID]->fluid[IMAG][k][j][i];
+         Real      = FaFluid[REAL][k][j][i];
+         Imag      = FaFluid[IMAG][k][j][i];
          Rho_Wrong = Real*Real + Imag*Imag;
-         Rho_Corr  = amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i];
+         Rho_Corr  = FaFluid[DENS][k][j][i];
 
 //       be careful about the negative density introduced from the round-off errors
          if ( Rho_Wrong <= (real)0.0  ||  Rho_Corr <= (real)0.0 )
          {
-            amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i] = (real)0.0;
+            FaFluid[DENS][k][j][i] = (real)0.0;
             Rescale = (real)0.0;
          }
          else
             Rescale = SQRT( Rho_Corr/Rho_Wrong );
 
-         amr->patch[FaFluSg][FaLv][FaPID]->fluid[REAL][k][j][i] *= Rescale;
-         amr->patch[FaFluSg][FaLv][FaPID]->fluid[IMAG][k][j][i] *= Rescale;
+         FaFluid[REAL][k][j][i] *= Rescale;
+         FaFluid[IMAG][k][j][i] *= Rescale;
       }
 #     endif
 
@@ -15,6 +15,8 @@
 //                h_Mag_Array_F_In     : Host array to store the prepared B field (for MHD onlhy)
 //                h_Pot_Array_USG_F    : Host array to store the prepared potential data (for UNSPLIT_GRAVITY only)
 //                h_Corner_Array_USG_F : Host array to store the prepared corner data (for UNSPLIT_GRAVITY only)
+//                h_PriVar_F_In        : Host array to store the prepared primitive variables (for OPT__FLU_PREP_PRI only)
+//                                       --> NULL if OPT__FLU_PREP_PRI is disabled
 //                NPG                  : Number of patch groups to be prepared at a time
 //                PID0_List            : List recording the patch indices with LocalID==0 to be udpated
 //-------------------------------------------------------------------------------------------------------
@@ -22,7 +24,8 @@ void Flu_Prepare( const int lv, const double PrepTime,
                   real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                   real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                   real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
-                  double h_Corner_Array_F[][3], const int NPG, const int *PID0_List )
+                  double h_Corner_Array_F[][3],
+                  real h_PriVar_F_In[][FLU_NIN][ CUBE(FLU_NXT) ], const int NPG, const int *PID0_List )
 {
 
 // check
@@ -66,10 +69,14 @@ void Flu_Prepare( const int lv, const double PrepTime,
 #  else
    real *Mag_Array = NULL;
 #  endif
+// also convert the fluid data to primitive variables for OPT__FLU_PREP_PRI
+   real *PriVar_Array = ( h_PriVar_F_In == NULL ) ? NULL : h_PriVar_F_In[0][0];
+
    Prepare_PatchData( lv, PrepTime, h_Flu_Array_F_In[0][0], Mag_Array,
                       FLU_GHOST_SIZE, NPG, PID0_List, _TOTAL, _MAG,
                       OPT__FLU_INT_SCHEME, OPT__MAG_INT_SCHEME, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
-                      OPT__BC_FLU, BC_POT_NONE, MinDens,    MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency );
+                      OPT__BC_FLU, BC_POT_NONE, MinDens,    MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency,
+                      PriVar_Array );
 #  endif
 
 #  ifdef UNSPLIT_GRAVITY
@@ -33,6 +33,9 @@ void End_MemFree()
 #     endif
 
       delete amr;    amr = NULL;
+
+//    release the patch arena after all patches have been deleted
+      PatchArena_End();
    }
 
 
@@ -30,6 +30,7 @@ void End_MemFree_Fluid()
    for (int t=0; t<2; t++)
    {
       delete [] h_Flu_Array_F_In [t];  h_Flu_Array_F_In [t] = NULL;
+      delete [] h_PriVar_F_In    [t];  h_PriVar_F_In    [t] = NULL;
       delete [] h_Flu_Array_F_Out[t];  h_Flu_Array_F_Out[t] = NULL;
       delete [] h_Flux_Array     [t];  h_Flux_Array     [t] = NULL;
 #     ifdef UNSPLIT_GRAVITY
@@ -728,10 +728,6 @@ void Load_Parameter_Before_1200( FILE *File, const int FormatVersion, int &NLv_R
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      if ( max_patch != MAX_PATCH )
-         Aux_Message( stderr, "WARNING : %s : RESTART file (%d) != runtime (%d) !!\n",
-                      "MAX_PATCH", max_patch, MAX_PATCH );
-
       if ( flu_ghost_size != FLU_GHOST_SIZE )
          Aux_Message( stderr, "WARNING : %s : RESTART file (%d) != runtime (%d) !!\n",
                       "FLU_GHOST_SIZE", flu_ghost_size, FLU_GHOST_SIZE );
@@ -1198,7 +1194,7 @@ void Load_Parameter_After_1200( FILE *File, const int FormatVersion, int &NLv_Re
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      CompareVar( "MAX_PATCH", max_patch, MAX_PATCH, NonFatal );
+//    do not compare MAX_PATCH since the patch table is growable and MAX_PATCH only serves as an optional upper limit
 
 
 
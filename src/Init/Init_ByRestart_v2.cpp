@@ -1188,7 +1188,7 @@ void Load_Parameter_After_2000( FILE *File, const int FormatVersion, int &NLv_Re
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      CompareVar( "MAX_PATCH", max_patch, MAX_PATCH, NonFatal );
+//    do not compare MAX_PATCH since the patch table is growable and MAX_PATCH only serves as an optional upper limit
 
       CompareVar( "EOS",       eos,       EOS,       NonFatal );
 
@@ -9,8 +9,6 @@ extern void (*Par_Init_ByFunction_Ptr)( const long NPar_ThisRank, const long NPa
                                         real *ParType, real *AllAttribute[PAR_NATT_TOTAL] );
 #endif
 
-extern bool   IsInit_tcool[NLEVEL];
-
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init
@@ -61,6 +59,11 @@ void Init_GAMER( int *argc, char ***argv )
 #  endif
 
 
+// initialize the patch arena
+// --> must be called after Init_OpenMP() and before allocating any patch
+   PatchArena_Init();
+
+
 // initialize GPU
 // --> must be called before Init_ExtAccPot() and EoS_Init()
 #  ifdef GPU
@@ -335,54 +338,12 @@ void Init_GAMER( int *argc, char ***argv )
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", "Initiating source-term fields" );
    } // if ( OPT__INIT != INIT_BY_RESTART )
 
-/*
-// Initialize tcool for ExactCooling
-#  ifdef OPENMP
-   const int NT = OMP_NTHREAD;   // number of OpenMP threads
-#  else
-   const int NT = 1;
-#  endif
+   else
+   {
+//    the cooling time loaded from the restart file is consistent with the current fluid data
+      if ( SrcTerms.ExactCooling )
+      for (int lv=0; lv<NLEVEL; lv++)
+         Src_ValidateTCool_ExactCooling( lv, amr->FluSg[lv], amr->FluSgTime[lv][ amr->FluSg[lv] ] );
+   } // if ( OPT__INIT != INIT_BY_RESTART ) ... else ...
 
-   for (int lv=0; lv<NLEVEL; lv++){
-#     pragma omp parallel
-      {
-#        ifdef OPENMP
-         const int TID = omp_get_thread_num();
-#        else
-         const int TID = 0;
-#        endif
-         const double dh = amr->dh[lv]; 
-#        pragma omp for schedule( runtime )
-         for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-         {
-            for (int k=0; k<PS1; k++)  {
-            for (int j=0; j<PS1; j++)  {
-            for (int i=0; i<PS1; i++)  {
- 
-#              ifdef MHD
-               real B[NCOMP_MAG];
-               MHD_GetCellCenteredBFieldInPatch( B, lv, PID, i, j, k, amr->MagSg[lv] );
-#              else
-               real *B    = NULL;
-#              endif // ifdef MHD ... else ...
-
-               const double z = amr->patch[0][lv][PID]->EdgeL[2] + (k+0.5)*dh;
-               const double y = amr->patch[0][lv][PID]->EdgeL[1] + (j+0.5)*dh;
-               const double x = amr->patch[0][lv][PID]->EdgeL[0] + (i+0.5)*dh;
-//             call Src_ExactCooling() to compute the cooling time
-               real fluid[FLU_NIN_S];
-               for (int v=0; v<FLU_NIN_S; v++)  fluid[v] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
-               SrcTerms.EC_CPUPtr( fluid, B, &SrcTerms, 0.0, NULL_REAL, x, y, z, NULL_REAL, NULL_REAL,
-                                   MIN_DENS, MIN_PRES, MIN_EINT, NULL,
-                                   Src_EC_AuxArray_Flt, Src_EC_AuxArray_Int );
-               amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[TCOOL][k][j][i] = fluid[TCOOL];
-            }}} // i,j,k
-         } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-      } // OpenMP parallel region
-
-//      IsInit_tcool[lv] = true;
-      printf( "Debugging!! Successfully initialize tcool. fluid[TCOOL] = %14.8e\n", amr->patch[ amr->FluSg[0] ][0][0]->fluid[TCOOL][0][1][0] );
-
-   } // for (int lv=0; lv<NLEVEL; lv++)
-*/
 } // FUNCTION : Init_GAMER
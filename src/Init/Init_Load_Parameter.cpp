@@ -137,6 +137,7 @@ void Init_Load_Parameter()
 // grid refinement
    ReadPara->Add( "REGRID_COUNT",               &REGRID_COUNT,                    4,               1,             NoMax_int      );
    ReadPara->Add( "REFINE_NLEVEL",              &REFINE_NLEVEL,                   1,               1,             NoMax_int      );
+   ReadPara->Add( "OPT__REGRID_SKIP_UNCHANGED", &OPT__REGRID_SKIP_UNCHANGED,      true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "FLAG_BUFFER_SIZE",           &FLAG_BUFFER_SIZE,               -1,               NoMin_int,     PS1            );
    ReadPara->Add( "FLAG_BUFFER_SIZE_MAXM1_LV",  &FLAG_BUFFER_SIZE_MAXM1_LV,      -1,               NoMin_int,     PS1            );
    ReadPara->Add( "FLAG_BUFFER_SIZE_MAXM2_LV",  &FLAG_BUFFER_SIZE_MAXM2_LV,      -1,               NoMin_int,     PS1            );
@@ -148,6 +149,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__FLAG_PRES_GRADIENT",    &OPT__FLAG_PRES_GRADIENT,         false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__FLAG_VORTICITY",        &OPT__FLAG_VORTICITY,             false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__FLAG_JEANS",            &OPT__FLAG_JEANS,                 false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FLAG_TCOOL_TFF",        &OPT__FLAG_TCOOL_TFF,             false,           Useless_bool,  Useless_bool   );
 #  ifdef MHD
    ReadPara->Add( "OPT__FLAG_CURRENT",          &OPT__FLAG_CURRENT,               false,           Useless_bool,  Useless_bool   );
 #  endif
@@ -175,6 +177,7 @@ void Init_Load_Parameter()
 #  endif
    ReadPara->Add( "OPT__REUSE_MEMORY",          &OPT__REUSE_MEMORY,               2,               0,             2              );
    ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__PATCH_ARENA",           &OPT__PATCH_ARENA,                true,            Useless_bool,  Useless_bool   );
 
 
 // load balance
@@ -192,7 +195,18 @@ void Init_Load_Parameter()
    ReadPara->Add( "SRC_DELEPTONIZATION",        &SrcTerms.Deleptonization,        false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "SRC_EXACTCOOLING",           &SrcTerms.ExactCooling,           false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "SRC_EC_TEF_N",               &SrcTerms.EC_TEF_N,               1501,            1,             NoMax_int      ); 
+   ReadPara->Add( "SRC_EC_X",                   &SrcTerms.EC_X,                   0.7,             0.0,           1.0            );
+   ReadPara->Add( "SRC_EC_Z",                   &SrcTerms.EC_Z,                   0.018,           0.0,           NoMax_double   );
+   ReadPara->Add( "SRC_EC_NZ",                  &SrcTerms.EC_NZ,                  1,               1,             NoMax_int      );
+   ReadPara->Add( "SRC_EC_ZMIN",                &SrcTerms.EC_ZMin,                0.0,             0.0,           NoMax_double   );
+   ReadPara->Add( "SRC_EC_ZMAX",                &SrcTerms.EC_ZMax,                0.04,            0.0,           NoMax_double   );
+   ReadPara->Add( "SRC_EC_MIXED_PRECISION",     &SrcTerms.EC_MixedPrecision,      0,               0,             1              );
+   ReadPara->Add( "SRC_EC_TABLE",                SRC_EC_TABLE,                    NoDef_str,       Useless_str,   Useless_str    );
+   ReadPara->Add( "SRC_EC_TEF_CACHE",            SRC_EC_TEF_CACHE,                NoDef_str,       Useless_str,   Useless_str    );
    ReadPara->Add( "SRC_USER",                   &SrcTerms.User,                   false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "SRC_SUBCYCLE_TOL",           &SrcTerms.SubcycleTol,           -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "SRC_SUBCYCLE_MAX_NSUB",      &SrcTerms.SubcycleMaxNSub,        1000,            1,             NoMax_int      );
+   ReadPara->Add( "SRC_FUSE_FLUID",             &SrcTerms.FuseFluid,              false,           Useless_bool,  Useless_bool   );
 // do not check SRC_GPU_NPGROUP since it may be reset by either Init_ResetDefaultParameter() or CUAPI_SetMemSize()
    ReadPara->Add( "SRC_GPU_NPGROUP",            &SRC_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
 
@@ -256,6 +270,9 @@ void Init_Load_Parameter()
 #  endif
    ReadPara->Add( "MINMOD_COEFF",               &MINMOD_COEFF,                    1.5,             1.0,           2.0            );
    ReadPara->Add( "MINMOD_MAX_ITER",            &MINMOD_MAX_ITER,                   0,               0,           NoMax_int      );
+   ReadPara->Add( "MINMOD_LOCAL_FALLBACK",      &MINMOD_LOCAL_FALLBACK,           false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FLU_PREP_PRI",          &OPT__FLU_PREP_PRI,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "FLU_TILE_NZ",                &FLU_TILE_NZ,                       0,               0,           PS2            );
    ReadPara->Add( "OPT__LR_LIMITER",            &OPT__LR_LIMITER,             LR_LIMITER_DEFAULT, -1,             6              );
    ReadPara->Add( "OPT__1ST_FLUX_CORR",         &OPT__1ST_FLUX_CORR,               -1,             NoMin_int,     2              );
 #  ifdef MHD
@@ -289,6 +306,11 @@ void Init_Load_Parameter()
 // do not check FLU_GPU_NPGROUP and GPU_NSTREAM since they may be reset by either Init_ResetDefaultParameter() or CUAPI_SetMemSize()
    ReadPara->Add( "FLU_GPU_NPGROUP",            &FLU_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "GPU_NSTREAM",                &GPU_NSTREAM,                    -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__PIPELINE_SOLVER",       &OPT__PIPELINE_SOLVER,            false,           Useless_bool,  Useless_bool   );
+// do not check PIPELINE_NTHREAD since it may be reset by Init_ResetDefaultParameter()
+   ReadPara->Add( "PIPELINE_NTHREAD",           &PIPELINE_NTHREAD,               -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__AUTO_NPGROUP",          &OPT__AUTO_NPGROUP,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__CONCURRENT_DT",         &OPT__CONCURRENT_DT,              false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__FIXUP_FLUX",            &OPT__FIXUP_FLUX,                 true,            Useless_bool,  Useless_bool   );
 #  ifdef MHD
    ReadPara->Add( "OPT__FIXUP_ELECTRIC",        &OPT__FIXUP_ELECTRIC,             true,            Useless_bool,  Useless_bool   );
@@ -39,6 +39,10 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
    for (int t=0; t<2; t++)
    {
       h_Flu_Array_F_In [t] = new real [Flu_NPatchGroup][FLU_NIN ][ CUBE(FLU_NXT) ];
+#     ifdef FLU_PREP_PRI
+      if ( OPT__FLU_PREP_PRI )
+      h_PriVar_F_In    [t] = new real [Flu_NPatchGroup][FLU_NIN ][ CUBE(FLU_NXT) ];
+#     endif
       h_Flu_Array_F_Out[t] = new real [Flu_NPatchGroup][FLU_NOUT][ CUBE(PS2) ];
 
       if ( amr->WithFlux )
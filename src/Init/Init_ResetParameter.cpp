@@ -1,4 +1,5 @@
 #include "GAMER.h"
+#include "CUFLU.h"
 
 
 
@@ -150,6 +151,53 @@ void Init_ResetParameter()
 #  endif
 
 
+// fusing the source terms with the fluid solver is only supported by the CPU solvers
+// --> it also requires the fluid solver to advance the solution by the same dt as the source terms
+#  ifdef GPU
+   if ( SrcTerms.FuseFluid )
+   {
+      SrcTerms.FuseFluid = false;
+
+      PRINT_WARNING( SrcTerms.FuseFluid, FORMAT_INT, "since GPU is enabled" );
+   }
+#  endif
+
+   if ( SrcTerms.FuseFluid  &&  OPT__FREEZE_FLUID )
+   {
+      SrcTerms.FuseFluid = false;
+
+      PRINT_WARNING( SrcTerms.FuseFluid, FORMAT_INT, "since OPT__FREEZE_FLUID is enabled" );
+   }
+
+
+// mixed-precision mode of the exact cooling is only supported by the batched CPU solver CPU_SrcSolver_ExactCooling()
+// --> disable it when the exact cooling goes through the per-cell solver so that results do not depend on the solver path
+#  if ( MODEL == HYDRO )
+#  ifdef GPU
+   if ( SrcTerms.EC_MixedPrecision )
+   {
+      SrcTerms.EC_MixedPrecision = 0;
+
+      PRINT_WARNING( SrcTerms.EC_MixedPrecision, FORMAT_INT, "since GPU is enabled" );
+   }
+#  endif
+
+   if ( SrcTerms.EC_MixedPrecision  &&  SrcTerms.FuseFluid )
+   {
+      SrcTerms.EC_MixedPrecision = 0;
+
+      PRINT_WARNING( SrcTerms.EC_MixedPrecision, FORMAT_INT, "since SRC_FUSE_FLUID is enabled" );
+   }
+
+   if ( SrcTerms.EC_MixedPrecision  &&  ( SrcTerms.Deleptonization || SrcTerms.User ) )
+   {
+      SrcTerms.EC_MixedPrecision = 0;
+
+      PRINT_WARNING( SrcTerms.EC_MixedPrecision, FORMAT_INT, "since other source terms are enabled" );
+   }
+#  endif // #if ( MODEL == HYDRO )
+
+
 // GPU parameters when using CPU only (must set OMP_NTHREAD in advance)
 #  ifndef GPU
    GPU_NSTREAM = 1;
@@ -206,6 +254,87 @@ void Init_ResetParameter()
 #  endif // #ifndef GPU
 
 
+// pipeline of the CPU solvers (must set OMP_NTHREAD in advance)
+#  ifdef GPU
+   if ( OPT__PIPELINE_SOLVER )
+   {
+      OPT__PIPELINE_SOLVER = false;
+
+      PRINT_WARNING( OPT__PIPELINE_SOLVER, FORMAT_INT, "since GPU is enabled" );
+   }
+#  endif
+
+#  if ( defined TIMING_SOLVER  &&  defined TIMING )
+   if ( OPT__PIPELINE_SOLVER )
+   {
+      OPT__PIPELINE_SOLVER = false;
+
+      PRINT_WARNING( OPT__PIPELINE_SOLVER, FORMAT_INT, "since TIMING_SOLVER is enabled" );
+   }
+#  endif
+
+   if ( OPT__PIPELINE_SOLVER  &&  OMP_NTHREAD < 2 )
+   {
+      OPT__PIPELINE_SOLVER = false;
+
+      PRINT_WARNING( OPT__PIPELINE_SOLVER, FORMAT_INT, "since OMP_NTHREAD < 2" );
+   }
+
+   if ( OPT__PIPELINE_SOLVER  &&  PIPELINE_NTHREAD <= 0 )
+   {
+      PIPELINE_NTHREAD = MAX( 1, OMP_NTHREAD/4 );
+
+      PRINT_WARNING( PIPELINE_NTHREAD, FORMAT_INT, "" );
+   }
+
+
+// concurrent dt estimation on the finer level (must set OMP_NTHREAD in advance)
+#  if ( defined GPU  ||  MODEL != HYDRO )
+   if ( OPT__CONCURRENT_DT )
+   {
+      OPT__CONCURRENT_DT = false;
+
+#     ifdef GPU
+      PRINT_WARNING( OPT__CONCURRENT_DT, FORMAT_INT, "since GPU is enabled" );
+#     else
+      PRINT_WARNING( OPT__CONCURRENT_DT, FORMAT_INT, "since MODEL != HYDRO" );
+#     endif
+   }
+#  endif
+
+#  if ( defined TIMING_SOLVER  &&  defined TIMING )
+   if ( OPT__CONCURRENT_DT )
+   {
+      OPT__CONCURRENT_DT = false;
+
+      PRINT_WARNING( OPT__CONCURRENT_DT, FORMAT_INT, "since TIMING_SOLVER is enabled" );
+   }
+#  endif
+
+   if ( OPT__CONCURRENT_DT  &&  OMP_NTHREAD < 2 )
+   {
+      OPT__CONCURRENT_DT = false;
+
+      PRINT_WARNING( OPT__CONCURRENT_DT, FORMAT_INT, "since OMP_NTHREAD < 2" );
+   }
+
+   if ( OPT__CONCURRENT_DT  &&  OPT__DT_LEVEL != DT_LEVEL_FLEXIBLE )
+   {
+      OPT__CONCURRENT_DT = false;
+
+      PRINT_WARNING( OPT__CONCURRENT_DT, FORMAT_INT, "since OPT__DT_LEVEL != DT_LEVEL_FLEXIBLE" );
+   }
+
+// Pipeline_Step() splits all OMP_NTHREAD threads between its own two teams and would thus oversubscribe
+// the cores when running concurrently with the dt estimation
+   if ( OPT__CONCURRENT_DT  &&  OPT__PIPELINE_SOLVER )
+   {
+      OPT__CONCURRENT_DT = false;
+
+      PRINT_WARNING( OPT__CONCURRENT_DT, FORMAT_INT, "since OPT__PIPELINE_SOLVER is enabled" );
+   }
+
+
 // derived parameters related to the simulation scale
    int NX0_Max;
    NX0_Max = ( NX0_TOT[0] > NX0_TOT[1] ) ? NX0_TOT[0] : NX0_TOT[1];
@@ -680,6 +809,49 @@ void Init_ResetParameter()
 #  endif // #if ( MODEL == HYDRO )
 
 
+// MINMOD_LOCAL_FALLBACK is only supported by the CPU MHM/MHM_RP integrators in pure hydro
+// --> it replaces the iterations of MINMOD_MAX_ITER
+#  if ( MODEL == HYDRO )
+#  if (  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  &&  !defined GPU  &&  !defined MHD  )
+   if ( MINMOD_LOCAL_FALLBACK  &&  MINMOD_MAX_ITER != 0 )
+   {
+      MINMOD_MAX_ITER = 0;
+
+      PRINT_WARNING( MINMOD_MAX_ITER, FORMAT_INT, "since MINMOD_LOCAL_FALLBACK is enabled" );
+   }
+#  else
+   if ( MINMOD_LOCAL_FALLBACK )
+   {
+      MINMOD_LOCAL_FALLBACK = false;
+
+      PRINT_WARNING( MINMOD_LOCAL_FALLBACK, FORMAT_INT, "since it's only supported by the CPU MHM/MHM_RP integrators without MHD" );
+   }
+#  endif
+#  endif // #if ( MODEL == HYDRO )
+
+
+// OPT__FLU_PREP_PRI is only supported by the CPU MHM integrator in pure hydro (see FLU_PREP_PRI in CUFLU.h)
+#  if ( MODEL == HYDRO  &&  !defined FLU_PREP_PRI )
+   if ( OPT__FLU_PREP_PRI )
+   {
+      OPT__FLU_PREP_PRI = false;
+
+      PRINT_WARNING( OPT__FLU_PREP_PRI, FORMAT_INT, "since it's only supported by the CPU MHM integrator without MHD and LR_EINT" );
+   }
+#  endif
+
+
+// FLU_TILE_NZ is only supported by the CPU MHM/MHM_RP integrators in pure hydro (see FLU_TILE in CUFLU.h)
+#  if ( MODEL == HYDRO  &&  !defined FLU_TILE )
+   if ( FLU_TILE_NZ != 0 )
+   {
+      FLU_TILE_NZ = 0;
+
+      PRINT_WARNING( FLU_TILE_NZ, FORMAT_INT, "since it's only supported by the CPU MHM/MHM_RP integrators without MHD, CHAR_RECONSTRUCTION, and LR_EINT" );
+   }
+#  endif
+
+
 // disable the refinement flag of Jeans length if GRAVITY is disabled
 #  if ( MODEL == HYDRO  &&  !defined GRAVITY )
    if ( OPT__FLAG_JEANS )
@@ -691,6 +863,26 @@ void Init_ResetParameter()
 #  endif
 
 
+// disable the refinement flag of the cooling time over the free-fall time if GRAVITY or SRC_EXACTCOOLING is disabled
+#  if ( MODEL == HYDRO )
+#  ifndef GRAVITY
+   if ( OPT__FLAG_TCOOL_TFF )
+   {
+      OPT__FLAG_TCOOL_TFF = false;
+
+      PRINT_WARNING( OPT__FLAG_TCOOL_TFF, FORMAT_INT, "since GRAVITY is disabled" );
+   }
+#  endif
+
+   if ( OPT__FLAG_TCOOL_TFF  &&  !SrcTerms.ExactCooling )
+   {
+      OPT__FLAG_TCOOL_TFF = false;
+
+      PRINT_WARNING( OPT__FLAG_TCOOL_TFF, FORMAT_INT, "since SRC_EXACTCOOLING is disabled" );
+   }
+#  endif // #if ( MODEL == HYDRO )
+
+
 // flux operation in ELBDM is useful only if CONSERVE_MASS is on
 #  if ( MODEL == ELBDM  &&  !defined CONSERVE_MASS )
    if ( OPT__FIXUP_FLUX )
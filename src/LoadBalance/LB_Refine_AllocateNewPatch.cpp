@@ -10,10 +10,9 @@ void PrepareCData( const int FaLv, const int FaPID, real *const FaData,
                    const int FaSg_Mag, const int FaGhost_Mag,
                    const int BC_Face[], const int FluVarIdxList[] );
 void LB_Refine_AllocateBufferPatch_Sibling( const int SonLv );
-static int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int FaPID, real *CData,
-                             const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
-                             const int BC_Face[], const int FluVarIdxList[],
-                             const real *CFB_BFieldEachRank[], const int CFB_SibRank[], long CFB_OffsetEachRank[] );
+static void AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int FaPID, const int SonPID0, real *CData,
+                              const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
+                              const int BC_Face[], const int FluVarIdxList[], const real *Mag_FInterface_Ptr[] );
 static void DeallocateSonPatch( const int FaLv, const int FaPID, const int NNew_Real0, int NewSonPID0_Real[],
                                 int SwitchIdx, int &RefineS2F_Send_NPatchTotal, int *&RefineS2F_Send_PIDList );
 
@@ -278,7 +277,6 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
    int *NewSonPID0_NoFa = new int [ NNew_Away ];         // NNew_Away is the maximum number this array can have
    int *NewSonPID0_All  = (int*)malloc( NNew_Real0*sizeof(int) );
    int *NewSonPID0_Real = NewSonPID0_All;
-   int *NewSonPID0_Away = NewSonPID0_All + NNew_Home;
 
 
 // parameters for spatial interpolation
@@ -343,67 +341,152 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
    CFB_BFieldEachRank[r] = CFB_BFieldEachRank[r-1] + CFB_NSibEachRank[r-1]*SQR( PS2 );
 
    for (int r=0; r<MPI_NRank; r++)  CFB_OffsetEachRank[r] = 0;
-
-#  else
-   const real **CFB_BFieldEachRank = NULL;
-         long  *CFB_OffsetEachRank = NULL;
 #  endif
 
 
-// 3.1 home patches
+// 3.1 determine the father patch, corner, and coarse-grid data of each group of eight new son patches
+//     --> done serially so that the son patch indices are identical to those of a serial allocation
+   int  (*NewCr_All)[3]    = new int   [NNew_Real0][3];
+   int   *NewFaPID_All     = new int   [NNew_Real0];
+   real **NewCData_All     = new real* [NNew_Real0];
+
+// 3.1.1 home patches
    for (int t=0; t<NNew_Home; t++)
    {
       FaPID    = NewPID_Home[t];
       Cr3D_Ptr = amr->patch[0][FaLv][FaPID]->corner;
 
-      NewSonPID0_All[t] = AllocateSonPatch( FaLv, Cr3D_Ptr, PScale, FaPID,
-                                            NULL,
-                                            CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
-                                            BC_Face, FluVarIdxList,
-                                            CFB_BFieldEachRank, CFB_SibRank_Home[t], CFB_OffsetEachRank );
+      NewFaPID_All[t] = FaPID;
+      NewCData_All[t] = NULL;
+      for (int d=0; d<3; d++)    NewCr_All[t][d] = Cr3D_Ptr[d];
    }
 
-
-// 3.2 away patches
+// 3.1.2 away patches
    for (int t=0; t<NNew_Away; t++)
    {
-//    3.2.1 away patches without father patch
+      const int tt = NNew_Home + t;
+
+//    away patches without father patch
       if ( Match_New[t] == -1 )
       {
          FaPID = -1;
          Mis_Idx1D2Idx3D( BoxNScale_Padded, NewCr1D_Away[t], Cr3D );
          for (int d=0; d<3; d++)    Cr3D[d] = ( Cr3D[d] - Padded )*PS1;
+         Cr3D_Ptr = Cr3D;
+      }
 
-         NewSonPID0_Away[t] = AllocateSonPatch( FaLv, Cr3D, PScale, FaPID,
-                                                NewCData_Away+NewCr1D_Away_IdxTable[t]*CSize_Tot,
-                                                CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
-                                                NULL, NULL,
-                                                CFB_BFieldEachRank, CFB_SibRank_Away[t], CFB_OffsetEachRank );
+//    away patches with father patch
+      else
+      {
+         FaPID    = amr->LB->PaddedCr1DList_IdxTable[FaLv][ Match_New[t] ];
+         Cr3D_Ptr = amr->patch[0][FaLv][FaPID]->corner;
+      }
 
-//       record the SonPID (with LocalID == 0 ) with no father at home
+      NewFaPID_All[tt] = FaPID;
+      NewCData_All[tt] = NewCData_Away + NewCr1D_Away_IdxTable[t]*CSize_Tot;
+      for (int d=0; d<3; d++)    NewCr_All[tt][d] = Cr3D_Ptr[d];
+   }
+
+
+// 3.2 reserve the son patch indices and construct relation : father -> child
+   const int NewSonPID0_First = amr->Lvreserve( SonLv, 8*NNew_Real0 );
+
+   amr->NPatchComma[SonLv][1] += 8*NNew_Real0;
+
+   for (int t=0; t<NNew_Real0; t++)
+   {
+      FaPID   = NewFaPID_All[t];
+      SonPID0 = NewSonPID0_First + 8*t;
+
+      NewSonPID0_All[t] = SonPID0;
+
+      if ( FaPID != -1 )
+      {
+#        ifdef GAMER_DEBUG
+         if ( amr->patch[0][FaLv][FaPID]->son != -1 )
+            Aux_Error( ERROR_INFO, "FaLv %d, FaPID (%d) already has sons (SonPID = %d, duplicate SonPID = %d) !!\n",
+                       FaLv, FaPID, amr->patch[0][FaLv][FaPID]->son, SonPID0 );
+#        endif
+
+         amr->patch[0][FaLv][FaPID]->son = SonPID0;
+      }
+
+//    record the SonPID (with LocalID == 0 ) with no father at home
+      else
+      {
 #        ifdef GAMER_DEBUG
          if ( NNoFa >= NNew_Away )
             Aux_Error( ERROR_INFO, "FaLv %d, NNoFa (%d) exceeds the maximum number (%d) !!\n",
                        FaLv, NNoFa, NNew_Away );
 #        endif
 
-         NewSonPID0_NoFa[ NNoFa ++ ] = NewSonPID0_Away[t];
-      } // if ( Match_New[t] == -1 )
+         NewSonPID0_NoFa[ NNoFa ++ ] = SonPID0;
+      }
+   } // for (int t=0; t<NNew_Real0; t++)
 
 
-//    3.2.2 away patches with father patch
-      else
+// 3.3 set the B field on the coarse-fine interfaces
+//     --> must follow the order of CFB_BField[] prepared by each rank
+#  ifdef MHD
+   const real *(*Mag_FInterface_All)[6] = new const real* [NNew_Real0][6];
+
+   for (int t=0; t<NNew_Real0; t++)
+   {
+      const int *CFB_SibRank = ( t < NNew_Home ) ? CFB_SibRank_Home[t] : CFB_SibRank_Away[ t - NNew_Home ];
+
+      for (int s=0; s<6; s++)
       {
-         FaPID    = amr->LB->PaddedCr1DList_IdxTable[FaLv][ Match_New[t] ];
-         Cr3D_Ptr = amr->patch[0][FaLv][FaPID]->corner;
+         const int TRank = CFB_SibRank[s];
+
+//       we set TRank>=0 on the coarse-fine interfaces
+         if ( TRank >= 0 )
+         {
+            Mag_FInterface_All[t][s] = CFB_BFieldEachRank[TRank] + CFB_OffsetEachRank[TRank];
+
+            CFB_OffsetEachRank[TRank] += SQR( PS2 );
+         }
+
+         else
+            Mag_FInterface_All[t][s] = NULL;
+      }
+   }
+#  else
+   const real *(*Mag_FInterface_All)[6] = NULL;
+#  endif
 
-         NewSonPID0_Away[t] = AllocateSonPatch( FaLv, Cr3D_Ptr, PScale, FaPID,
-                                                NewCData_Away+NewCr1D_Away_IdxTable[t]*CSize_Tot,
-                                                CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
-                                                NULL, NULL,
-                                                CFB_BFieldEachRank, CFB_SibRank_Away[t], CFB_OffsetEachRank );
-      } // if ( Match_New[t] == -1 ) ... else ...
-   } // for (int t=0; t<NNew_Away; t++)
+
+// 3.4 allocate son patches and assign data by spatial interpolation
+#  pragma omp parallel for schedule( runtime )
+   for (int t=0; t<NNew_Real0; t++)
+   {
+      AllocateSonPatch( FaLv, NewCr_All[t], PScale, NewFaPID_All[t], NewSonPID0_All[t], NewCData_All[t],
+                        CGhost_Flu, NSide_Flu, CGhost_Pot, NSide_Pot, CGhost_Mag,
+                        ( t < NNew_Home ) ? BC_Face       : NULL,
+                        ( t < NNew_Home ) ? FluVarIdxList : NULL,
+                        ( Mag_FInterface_All == NULL ) ? NULL : Mag_FInterface_All[t] );
+   }
+
+
+// 3.5 pass particles from father to son if they are in the same rank
+//     --> otherwise these particles will be transferred to the real son patches by calling
+//         Par_PassParticle2Son_MultiPatch() in LB_Refine()
+//     --> not parallelized since particle passing modifies the shared particle repository
+#  ifdef PARTICLE
+   for (int t=0; t<NNew_Real0; t++)
+   {
+      FaPID = NewFaPID_All[t];
+
+      if ( FaPID >= 0  &&  FaPID < amr->NPatchComma[FaLv][1] )    Par_PassParticle2Son_SinglePatch( FaLv, FaPID );
+   }
+#  endif
+
+
+   delete [] NewCr_All;
+   delete [] NewFaPID_All;
+   delete [] NewCData_All;
+#  ifdef MHD
+   delete [] Mag_FInterface_All;
+#  endif
 
 
 
@@ -646,12 +729,12 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 
       else if ( ! OPT__REUSE_MEMORY )
       {
-         delete [] flu_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+         PatchArena_Free( flu_BufBk[ PCr1D_BufBk_IdxTable[t] ] );
 #        ifdef GRAVITY
-         delete [] pot_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+         PatchArena_Free( pot_BufBk[ PCr1D_BufBk_IdxTable[t] ] );
 #        endif
 #        ifdef MHD
-         delete [] mag_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+         PatchArena_Free( mag_BufBk[ PCr1D_BufBk_IdxTable[t] ] );
 #        endif
       } // if ( Match_BufBk[t] != -1 ) ... else if ...
    } // for (int t=0; t<NBufBk; t++)
@@ -686,12 +769,16 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 // Function    :  AllocateSonPatch
 // Description :  Allocate eight son patches at FaLv+1
 //
-// Note        :  Just to avoid duplicate code segment
+// Note        :  1. Just to avoid duplicate code segment
+//                2. Son patch indices must be reserved in advance by amr->Lvreserve()
+//                   --> Relation father -> child, amr->NPatchComma[], and particles are NOT handled here
+//                3. Thread-safe as long as different threads work on different son patches
 //
 // Parameter   :  FaLv          : Target refinement level to be refined
 //                Cr            : Corner coordinates of the son patch with LocalID == 0
 //                PScale        : Scale of one patch at SonLv
 //                FaPID         : Father patch index (can be -1 for the away patches)
+//                SonPID0       : Reserved son patch index with LocalID == 0
 //                CData         : Coarse-grid data for assigning data to son patches by spatial interpolation
 //                                (initialize as NULL if father patch is home --> prepare CData here)
 //                CGhost_Flu    : Ghost size of the fluid data
@@ -702,47 +789,29 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 //                BC_Face       : Corresponding boundary faces (0~5) along 26 sibling directions -> for non-periodic B.C. only
 //                FluVarIdxList : List of target fluid variable indices                          -> for non-periodic B.C. only
 //
-//                MHD-only parameters
-//                CFB_BFieldEachRank : Coarse-fine interface B field array
-//                CFB_SibRank        : MPI ranks of the target sibling patches
-//                CFB_OffsetEachRank : Array offset of CFB_BFieldEachRank[] for each rank
+//                Mag_FInterface_Ptr : B field on the six coarse-fine interfaces (NULL if not a coarse-fine interface)
+//                                     --> for MHD only
 //
-// Return      :  SonPID with LocalID == 0, CFB_OffsetEachRank
+// Return      :  Data of the eight son patches
 //-------------------------------------------------------------------------------------------------------
-int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int FaPID, real *CData,
-                      const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
-                      const int BC_Face[], const int FluVarIdxList[],
-                      const real *CFB_BFieldEachRank[], const int CFB_SibRank[], long CFB_OffsetEachRank[] )
+void AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int FaPID, const int SonPID0, real *CData,
+                       const int CGhost_Flu, const int NSide_Flu, const int CGhost_Pot, const int NSide_Pot, const int CGhost_Mag,
+                       const int BC_Face[], const int FluVarIdxList[], const real *Mag_FInterface_Ptr[] )
 {
 
-   const int SonLv   = FaLv + 1;
-   const int SonPID0 = amr->num[SonLv];
-   bool FaIsHome     = false;
+   const int SonLv = FaLv + 1;
+   bool FaIsHome   = false;
 
 
-// 0. check : target father patch has no son
-#  ifdef GAMER_DEBUG
-   if ( FaPID != -1  &&  amr->patch[0][FaLv][FaPID]->son != -1 )
-      Aux_Error( ERROR_INFO, "FaLv %d, FaPID (%d) already has sons (SonPID = %d, duplicate SonPID = %d) !!\n",
-                 FaLv, FaPID, amr->patch[0][FaLv][FaPID]->son, SonPID0 );
-#  endif
-
-
-// 1. construct relation : father -> child
-   if ( FaPID != -1 )   amr->patch[0][FaLv][FaPID]->son = SonPID0;
-
-
-// 2. allocate child patches and construct relation : child -> father
-   amr->pnew( SonLv, Cr[0],        Cr[1],        Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1],        Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0],        Cr[1]+PScale, Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0],        Cr[1],        Cr[2]+PScale, FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1]+PScale, Cr[2],        FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0],        Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1],        Cr[2]+PScale, FaPID, true, true, true );
-   amr->pnew( SonLv, Cr[0]+PScale, Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true );
-
-   amr->NPatchComma[SonLv][1] += 8;
+// 1. allocate child patches at the reserved indices and construct relation : child -> father
+   amr->pnew( SonLv, Cr[0],        Cr[1],        Cr[2],        FaPID, true, true, true, SonPID0+0 );
+   amr->pnew( SonLv, Cr[0]+PScale, Cr[1],        Cr[2],        FaPID, true, true, true, SonPID0+1 );
+   amr->pnew( SonLv, Cr[0],        Cr[1]+PScale, Cr[2],        FaPID, true, true, true, SonPID0+2 );
+   amr->pnew( SonLv, Cr[0],        Cr[1],        Cr[2]+PScale, FaPID, true, true, true, SonPID0+3 );
+   amr->pnew( SonLv, Cr[0]+PScale, Cr[1]+PScale, Cr[2],        FaPID, true, true, true, SonPID0+4 );
+   amr->pnew( SonLv, Cr[0],        Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true, SonPID0+5 );
+   amr->pnew( SonLv, Cr[0]+PScale, Cr[1],        Cr[2]+PScale, FaPID, true, true, true, SonPID0+6 );
+   amr->pnew( SonLv, Cr[0]+PScale, Cr[1]+PScale, Cr[2]+PScale, FaPID, true, true, true, SonPID0+7 );
 
 
 // 3. assign data to child patches by spatial interpolation
@@ -857,22 +926,6 @@ int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int
    const real *CData_Mag3v[NCOMP_MAG] = { CData_MagX, CData_MagY, CData_MagZ };
          real *FData_Mag3v[NCOMP_MAG] = { FData_Mag[MAGX], FData_Mag[MAGY], FData_Mag[MAGZ] };
 
-// set the B field on the coarse-fine interfaces
-   const real *Mag_FInterface_Ptr[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-
-   for (int s=0; s<6; s++)
-   {
-      const int TRank = CFB_SibRank[s];
-
-//    we set TRank>=0 on the coarse-fine interfaces
-      if ( TRank >= 0 )
-      {
-         Mag_FInterface_Ptr[s] = CFB_BFieldEachRank[TRank] + CFB_OffsetEachRank[TRank];
-
-         CFB_OffsetEachRank[TRank] += SQR( PS2 );
-      }
-   }
-
 // perform divergence-free interpolation
    MHD_InterpolateBField( CData_Mag3v, CSize_Mag, CStart_Mag, CRange_Mag,
                           FData_Mag3v, FSize_Mag, FStart_Mag, Mag_FInterface_Ptr,
@@ -1155,14 +1208,6 @@ int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int
    } // for (int LocalID=0; LocalID<8; LocalID++)
 
 
-// 4. pass particles from father to son if they are in the same rank
-//    --> otherwise these particles will be transferred to the real son patches by calling
-//        Par_PassParticle2Son_MultiPatch() in LB_Refine()
-#  ifdef PARTICLE
-   if ( FaPID >= 0  &&  FaPID < amr->NPatchComma[FaLv][1] )    Par_PassParticle2Son_SinglePatch( FaLv, FaPID );
-#  endif
-
-
 // free memory
    if ( FaIsHome )   delete [] CData;
    delete [] FData_Flu;
@@ -1174,9 +1219,6 @@ int AllocateSonPatch( const int FaLv, const int *Cr, const int PScale, const int
    delete [] FData_Mag_CC_IntIter;
 #  endif
 
-
-   return SonPID0;
-
 } // FUNCTION : AllocateSonPatch
 
 
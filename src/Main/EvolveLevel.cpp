@@ -20,6 +20,8 @@ extern Timer_t *Timer_Par_2Son   [NLEVEL];
 
 bool AutoReduceDt_Continue;
 
+extern bool IsValid_tcool_min[NLEVEL];
+
 extern void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const double TimeNew, const double dt );
 extern void (*Mis_UserWorkBeforeNextLevel_Ptr)( const int lv, const double TimeNew, const double TimeOld, const double dt );
 extern void (*Mis_UserWorkBeforeNextSubstep_Ptr)( const int lv, const double TimeNew, const double TimeOld, const double dt );
@@ -501,7 +503,8 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       const int SaveSg_SrcFlu = SaveSg_Flu;  // save in the same Flu/MagSg
       const int SaveSg_SrcMag = SaveSg_Mag;
 
-      if ( SrcTerms.Any )
+//    skip it if the local source terms have been applied by the fluid solver
+      if ( SrcTerms.Any  &&  !SrcTerms.FuseFluid )
       {
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
             Aux_Message( stdout, "   Lv %2d: Src_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
@@ -772,6 +775,17 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
                                            _TOTAL, _MAG, Flu_ParaBuf, USELB_YES  ),
                         Timer_GetBuf[lv][3],   TIMER_ON   );
 
+//       12-5. the field TCOOL on lv recorded in Src_AdvanceDt() is not restricted and thus becomes inconsistent
+//             with the corrected coarse-grid data
+//             --> the minimum cooling time recorded in Src_AdvanceDt() is kept since it only serves as
+//                 a time-step estimate, which is not affected by the fix-up corrections at leading order
+#        ifdef MHD
+         if ( OPT__FIXUP_FLUX  ||  OPT__FIXUP_RESTRICT  ||  OPT__FIXUP_ELECTRIC )
+#        else
+         if ( OPT__FIXUP_FLUX  ||  OPT__FIXUP_RESTRICT )
+#        endif
+         Src_InvalidateTCool_ExactCooling( lv );
+
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 // ===============================================================================================
 
@@ -806,11 +820,26 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
 
 //          13-2. refine
+//          --> skip it if OPT__REGRID_SKIP_UNCHANGED is on and no patch changes its refinement status, in which case
+//              Refine() would just reconstruct the current patches and MPI lists at lv_refine and lv_refine+1
+//          --> otherwise both levels are still rebuilt from scratch
             if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "   Lv %2d: Refine %27s... ", lv_refine, "" );
 
+            bool RefineSkipped = false;
+
+            if ( OPT__REGRID_SKIP_UNCHANGED )
+            TIMING_FUNC(   RefineSkipped = ( Refine_CountChange( lv_refine, USELB_YES ) == 0 ),
+                           Timer_Refine[lv_refine],   TIMER_ON   );
+
+            if ( ! RefineSkipped )
             TIMING_FUNC(   Refine( lv_refine, USELB_YES ),
                            Timer_Refine[lv_refine],   TIMER_ON   );
 
+//          minimum cooling time and the field TCOOL recorded on lv_refine+1 in Src_AdvanceDt() become invalid
+//          after refinement
+            IsValid_tcool_min[lv_refine+1] = false;
+            Src_InvalidateTCool_ExactCooling( lv_refine+1 );
+
             Time          [lv_refine+1]                            = Time[lv_refine];
             amr->FluSgTime[lv_refine+1][ amr->FluSg[lv_refine+1] ] = Time[lv_refine];
 #           ifdef MHD
@@ -821,24 +850,34 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
             amr->PotSgTime[lv_refine+1][ amr->PotSg[lv_refine+1] ] = Time[lv_refine];
 #           endif
 
+//          for LOAD_BALANCE, DATA_AFTER_REFINE and POT_AFTER_REFINE only transfer the buffer data not covered by the
+//          old MPI lists, which remain unchanged if Refine() has been skipped
+#           ifdef LOAD_BALANCE
+            const bool GetBufAfterRefine = ! RefineSkipped;
+#           else
+            const bool GetBufAfterRefine = true;
+#           endif
+
 //          LOAD_BALANCE requires exchanging buffer data on the level being refined
 #           ifdef LOAD_BALANCE
+            if ( GetBufAfterRefine )
             TIMING_FUNC(   Buf_GetBufferData( lv_refine, amr->FluSg[lv_refine], amr->MagSg[lv_refine], NULL_INT, DATA_AFTER_REFINE,
                                               _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv_refine][4],   TIMER_ON   );
 #           ifdef GRAVITY
-            if ( UsePot )
+            if ( UsePot  &&  GetBufAfterRefine )
             TIMING_FUNC(   Buf_GetBufferData( lv_refine, NULL_INT, NULL_INT, amr->PotSg[lv_refine], POT_AFTER_REFINE,
                                               _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv_refine][5],   TIMER_ON   );
 #           endif
 #           endif // #ifdef LOAD_BALANCE
 
+            if ( GetBufAfterRefine )
             TIMING_FUNC(   Buf_GetBufferData( lv_refine+1, amr->FluSg[lv_refine+1], amr->MagSg[lv_refine+1], NULL_INT, DATA_AFTER_REFINE,
                                               _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv_refine][4],   TIMER_ON   );
 #           ifdef GRAVITY
-            if ( UsePot )
+            if ( UsePot  &&  GetBufAfterRefine )
             TIMING_FUNC(   Buf_GetBufferData( lv_refine+1, NULL_INT, NULL_INT, amr->PotSg[lv_refine+1], POT_AFTER_REFINE,
                                               _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv_refine][5],   TIMER_ON   );
@@ -859,6 +898,11 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 #           endif
          } // for (int lv_refine=lv, lv_refine<=lv_refine_max; lv_refine++)
 
+//       compact the patch tables of the refined levels and release the empty slabs of the patch arena
+         for (int lv_refine=lv+1; lv_refine<=lv_refine_max+1; lv_refine++)    amr->Lvcompact( lv_refine );
+
+         PatchArena_Shrink();
+
       } // if ( lv != TOP_LEVEL  &&  AdvanceCounter[lv] % REGRID_COUNT == 0 )
 // ===============================================================================================
 
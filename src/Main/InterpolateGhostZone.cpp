@@ -323,6 +323,11 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 // a1. fluid data
    CData_CC_Ptr = CData_CC;
 
+// load the patch pointers once instead of looking up the patch table in every cell
+// --> FluSg and FluSg_IntT are set only when fluid or derived variables are prepared
+   const real (*Fluid     )[PS1][PS1][PS1] = ( NVarCC_Flu+NVarCC_Der != 0 ) ? amr->patch[FluSg][lv][PID]->fluid : NULL;
+   const real (*Fluid_IntT)[PS1][PS1][PS1] = ( NVarCC_Flu+NVarCC_Der != 0  &&  FluIntTime ) ? amr->patch[FluSg_IntT][lv][PID]->fluid : NULL;
+
    for (int v=0; v<NVarCC_Flu; v++)
    {
       TVarCCIdx_Flu = TVarCCIdxList_Flu[v];
@@ -332,7 +337,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                           Idx = IDX321( Disp2[0], j2, k2, CSize_CC[0], CSize_CC[1] );
       for (i1=Disp1[0]; i1<Disp1[0]+Loop1[0]; i1++)   {
 
-         CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[TVarCCIdx_Flu][k1][j1][i1];
+         CData_CC_Ptr[Idx] = Fluid[TVarCCIdx_Flu][k1][j1][i1];
 
 //       temporal interpolation
 //       --> for IntPhase, apply temporal interpolation to density/phase instead of real/imaginary parts for better accuracy
@@ -342,7 +347,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
          if ( FluIntTime )
 #        endif
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                             + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][PID]->fluid[TVarCCIdx_Flu][k1][j1][i1];
+                             + FluWeighting_IntT*Fluid_IntT[TVarCCIdx_Flu][k1][j1][i1];
          Idx ++;
       }}}
 
@@ -359,13 +364,13 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                           Idx = IDX321( Disp2[0], j2, k2, CSize_CC[0], CSize_CC[1] );
       for (i1=Disp1[0]; i1<Disp1[0]+Loop1[0]; i1++)   {
 
-         CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[MOMX][k1][j1][i1] /
-                             amr->patch[FluSg][lv][PID]->fluid[DENS][k1][j1][i1];
+         CData_CC_Ptr[Idx] = Fluid[MOMX][k1][j1][i1] /
+                             Fluid[DENS][k1][j1][i1];
 
          if ( FluIntTime ) // temporal interpolation
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                             + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMX][k1][j1][i1] /
-                                                   amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k1][j1][i1] );
+                             + FluWeighting_IntT*( Fluid_IntT[MOMX][k1][j1][i1] /
+                                                   Fluid_IntT[DENS][k1][j1][i1] );
          Idx ++;
       }}}
 
@@ -379,13 +384,13 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                           Idx = IDX321( Disp2[0], j2, k2, CSize_CC[0], CSize_CC[1] );
       for (i1=Disp1[0]; i1<Disp1[0]+Loop1[0]; i1++)   {
 
-         CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[MOMY][k1][j1][i1] /
-                             amr->patch[FluSg][lv][PID]->fluid[DENS][k1][j1][i1];
+         CData_CC_Ptr[Idx] = Fluid[MOMY][k1][j1][i1] /
+                             Fluid[DENS][k1][j1][i1];
 
          if ( FluIntTime ) // temporal interpolation
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                             + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMY][k1][j1][i1] /
-                                                   amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k1][j1][i1] );
+                             + FluWeighting_IntT*( Fluid_IntT[MOMY][k1][j1][i1] /
+                                                   Fluid_IntT[DENS][k1][j1][i1] );
          Idx ++;
       }}}
 
@@ -399,13 +404,13 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                           Idx = IDX321( Disp2[0], j2, k2, CSize_CC[0], CSize_CC[1] );
       for (i1=Disp1[0]; i1<Disp1[0]+Loop1[0]; i1++)   {
 
-         CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][PID]->fluid[MOMZ][k1][j1][i1] /
-                             amr->patch[FluSg][lv][PID]->fluid[DENS][k1][j1][i1];
+         CData_CC_Ptr[Idx] = Fluid[MOMZ][k1][j1][i1] /
+                             Fluid[DENS][k1][j1][i1];
 
          if ( FluIntTime ) // temporal interpolation
          CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                             + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMZ][k1][j1][i1] /
-                                                   amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k1][j1][i1] );
+                             + FluWeighting_IntT*( Fluid_IntT[MOMZ][k1][j1][i1] /
+                                                   Fluid_IntT[DENS][k1][j1][i1] );
          Idx ++;
       }}}
 
@@ -419,7 +424,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                           Idx = IDX321( Disp2[0], j2, k2, CSize_CC[0], CSize_CC[1] );
       for (i1=Disp1[0]; i1<Disp1[0]+Loop1[0]; i1++)   {
 
-         for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][PID]->fluid[v][k1][j1][i1];
+         for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k1][j1][i1];
 
 #        ifdef MHD
          const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i1, j1, k1, MagSg );
@@ -434,7 +439,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
          if ( FluIntTime ) // temporal interpolation
          {
-            for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k1][j1][i1];
+            for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k1][j1][i1];
 
 #           ifdef MHD
             const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i1, j1, k1, MagSg_IntT );
@@ -463,7 +468,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                           Idx = IDX321( Disp2[0], j2, k2, CSize_CC[0], CSize_CC[1] );
       for (i1=Disp1[0]; i1<Disp1[0]+Loop1[0]; i1++)   {
 
-         for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][PID]->fluid[v][k1][j1][i1];
+         for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k1][j1][i1];
 
 #        ifdef MHD
          const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i1, j1, k1, MagSg );
@@ -478,7 +483,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
          if ( FluIntTime ) // temporal interpolation
          {
-            for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k1][j1][i1];
+            for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k1][j1][i1];
 
 #           ifdef MHD
             const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i1, j1, k1, MagSg_IntT );
@@ -507,7 +512,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                           Idx = IDX321( Disp2[0], j2, k2, CSize_CC[0], CSize_CC[1] );
       for (i1=Disp1[0]; i1<Disp1[0]+Loop1[0]; i1++)   {
 
-         for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][PID]->fluid[v][k1][j1][i1];
+         for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k1][j1][i1];
 
 #        ifdef MHD
          const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i1, j1, k1, MagSg );
@@ -522,7 +527,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
          if ( FluIntTime ) // temporal interpolation
          {
-            for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k1][j1][i1];
+            for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k1][j1][i1];
 
 #           ifdef MHD
             const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i1, j1, k1, MagSg_IntT );
@@ -717,6 +722,11 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
       {
          CData_CC_Ptr = CData_CC;
 
+//       load the patch pointers once instead of looking up the patch table in every cell
+//       --> FluSg and FluSg_IntT are set only when fluid or derived variables are prepared
+         const real (*Fluid     )[PS1][PS1][PS1] = ( NVarCC_Flu+NVarCC_Der != 0 ) ? amr->patch[FluSg][lv][SibPID]->fluid : NULL;
+         const real (*Fluid_IntT)[PS1][PS1][PS1] = ( NVarCC_Flu+NVarCC_Der != 0  &&  FluIntTime ) ? amr->patch[FluSg_IntT][lv][SibPID]->fluid : NULL;
+
 //       b1-1. fluid data
          for (int v=0; v<NVarCC_Flu; v++)
          {
@@ -727,7 +737,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                 Idx = IDX321( Disp3[0], j1, k1, CSize_CC[0], CSize_CC[1] );
             for (i2=Disp4[0]; i2<Disp4[0]+Loop2[0]; i2++)   {
 
-               CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[TVarCCIdx_Flu][k2][j2][i2];
+               CData_CC_Ptr[Idx] = Fluid[TVarCCIdx_Flu][k2][j2][i2];
 
 //             temporal interpolation
 //             --> for IntPhase, apply temporal interpolation to density/phase instead of real/imaginary parts for better accuracy
@@ -737,7 +747,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                if ( FluIntTime )
 #              endif
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                                   + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][SibPID]->fluid[TVarCCIdx_Flu][k2][j2][i2];
+                                   + FluWeighting_IntT*Fluid_IntT[TVarCCIdx_Flu][k2][j2][i2];
 
                Idx ++;
             }}}
@@ -755,13 +765,13 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                 Idx = IDX321( Disp3[0], j1, k1, CSize_CC[0], CSize_CC[1] );
             for (i2=Disp4[0]; i2<Disp4[0]+Loop2[0]; i2++)   {
 
-               CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[MOMX][k2][j2][i2] /
-                                   amr->patch[FluSg][lv][SibPID]->fluid[DENS][k2][j2][i2];
+               CData_CC_Ptr[Idx] = Fluid[MOMX][k2][j2][i2] /
+                                   Fluid[DENS][k2][j2][i2];
 
                if ( FluIntTime ) // temporal interpolation
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                                   + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMX][k2][j2][i2] /
-                                                         amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][k2][j2][i2] );
+                                   + FluWeighting_IntT*( Fluid_IntT[MOMX][k2][j2][i2] /
+                                                         Fluid_IntT[DENS][k2][j2][i2] );
                Idx ++;
             }}}
 
@@ -775,13 +785,13 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                 Idx = IDX321( Disp3[0], j1, k1, CSize_CC[0], CSize_CC[1] );
             for (i2=Disp4[0]; i2<Disp4[0]+Loop2[0]; i2++)   {
 
-               CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[MOMY][k2][j2][i2] /
-                                   amr->patch[FluSg][lv][SibPID]->fluid[DENS][k2][j2][i2];
+               CData_CC_Ptr[Idx] = Fluid[MOMY][k2][j2][i2] /
+                                   Fluid[DENS][k2][j2][i2];
 
                if ( FluIntTime ) // temporal interpolation
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                                   + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMY][k2][j2][i2] /
-                                                         amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][k2][j2][i2] );
+                                   + FluWeighting_IntT*( Fluid_IntT[MOMY][k2][j2][i2] /
+                                                         Fluid_IntT[DENS][k2][j2][i2] );
                Idx ++;
             }}}
 
@@ -795,13 +805,13 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                 Idx = IDX321( Disp3[0], j1, k1, CSize_CC[0], CSize_CC[1] );
             for (i2=Disp4[0]; i2<Disp4[0]+Loop2[0]; i2++)   {
 
-               CData_CC_Ptr[Idx] = amr->patch[FluSg][lv][SibPID]->fluid[MOMZ][k2][j2][i2] /
-                                   amr->patch[FluSg][lv][SibPID]->fluid[DENS][k2][j2][i2];
+               CData_CC_Ptr[Idx] = Fluid[MOMZ][k2][j2][i2] /
+                                   Fluid[DENS][k2][j2][i2];
 
                if ( FluIntTime ) // temporal interpolation
                CData_CC_Ptr[Idx] =   FluWeighting     *CData_CC_Ptr[Idx]
-                                   + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMZ][k2][j2][i2] /
-                                                         amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][k2][j2][i2] );
+                                   + FluWeighting_IntT*( Fluid_IntT[MOMZ][k2][j2][i2] /
+                                                         Fluid_IntT[DENS][k2][j2][i2] );
                Idx ++;
             }}}
 
@@ -815,7 +825,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                 Idx = IDX321( Disp3[0], j1, k1, CSize_CC[0], CSize_CC[1] );
             for (i2=Disp4[0]; i2<Disp4[0]+Loop2[0]; i2++)   {
 
-               for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][SibPID]->fluid[v][k2][j2][i2];
+               for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k2][j2][i2];
 
 #              ifdef MHD
                const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, i2, j2, k2, MagSg );
@@ -830,7 +840,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
                if ( FluIntTime ) // temporal interpolation
                {
-                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][k2][j2][i2];
+                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k2][j2][i2];
 
 #                 ifdef MHD
                   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, i2, j2, k2, MagSg_IntT );
@@ -859,7 +869,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                 Idx = IDX321( Disp3[0], j1, k1, CSize_CC[0], CSize_CC[1] );
             for (i2=Disp4[0]; i2<Disp4[0]+Loop2[0]; i2++)   {
 
-               for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][SibPID]->fluid[v][k2][j2][i2];
+               for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k2][j2][i2];
 
 #              ifdef MHD
                const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, i2, j2, k2, MagSg );
@@ -874,7 +884,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
                if ( FluIntTime ) // temporal interpolation
                {
-                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][k2][j2][i2];
+                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k2][j2][i2];
 
 #                 ifdef MHD
                   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, i2, j2, k2, MagSg_IntT );
@@ -903,7 +913,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                                                 Idx = IDX321( Disp3[0], j1, k1, CSize_CC[0], CSize_CC[1] );
             for (i2=Disp4[0]; i2<Disp4[0]+Loop2[0]; i2++)   {
 
-               for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][SibPID]->fluid[v][k2][j2][i2];
+               for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k2][j2][i2];
 
 #              ifdef MHD
                const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, i2, j2, k2, MagSg );
@@ -918,7 +928,7 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
                if ( FluIntTime ) // temporal interpolation
                {
-                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][k2][j2][i2];
+                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k2][j2][i2];
 
 #                 ifdef MHD
                   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, i2, j2, k2, MagSg_IntT );
@@ -5,7 +5,33 @@ static void Preparation_Step( const Solver_t TSolver, const int lv, const double
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
                     const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                          const int NPG, const int *PID0_List, const int ArrayID, const double dt );
+                          const int NPG, const int *PID0_List, const int ArrayID, const double dt,
+                          const double TimeNew, const double TimeOld );
+#ifndef GPU
+static void Pipeline_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                           const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                           const int NTotal, const int NPG_Max, const int *PID0_List );
+#endif
+static int  AutoNPG_GetBatchSize( const Solver_t TSolver, const int lv, const int NPG_Cap );
+static void AutoNPG_Record( const Solver_t TSolver, const int lv, const int NPG_Cap, const int NPG, const int NTotal,
+                            const double Time );
+
+// state of the auto-tuned batch size of each solver on each level (for OPT__AUTO_NPGROUP)
+struct AutoNPG_t
+{
+   int    NPG;       // batch size currently being measured (<=0 : not initialized yet)
+   int    NSample;   // number of samples recorded for NPG
+   long   NPGSum;    // total number of patch groups advanced with NPG
+   double TimeSum;   // total wall-clock time spent with NPG
+   int    BestNPG;   // batch size with the lowest cost so far
+   double BestCost;  // wall-clock time per patch group of BestNPG
+   bool   Done;      // true --> BestNPG has been fixed
+};
+
+static AutoNPG_t AutoNPG[NLEVEL][NSOLVER];
+
+// number of invocations measured for each trial batch size
+const int AutoNPG_NSample = 3;
 
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
@@ -33,6 +59,8 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                   the input data
 //                4. For LOAD_BALANCE, one can turn on the option "OPT__OVERLAP_MPI" to enable the
 //                   overlapping between MPI communication and CPU/GPU computation
+//                5. For CPU-only runs, one can turn on the option "OPT__PIPELINE_SOLVER" to overlap the
+//                   preparation and closing steps with the execution step (see Pipeline_Step())
 //
 // Parameter   :  TSolver      : Target solver
 //                               --> FLUID_SOLVER               : Fluid / ELBDM solver
@@ -134,6 +162,17 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
          Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TSolver", TSolver );
    }
 
+// adapt the batch size to the measured throughput if OPT__AUTO_NPGROUP is on
+// --> the batch size set above is the size of the allocated arrays and is therefore used as the upper bound
+   const int NPG_Cap = NPG_Max;
+   Timer_t   Timer_AutoNPG;
+
+   if ( OPT__AUTO_NPGROUP )
+   {
+      NPG_Max = AutoNPG_GetBatchSize( TSolver, lv, NPG_Cap );
+      Timer_AutoNPG.Start();
+   }
+
 
    int *PID0_List    = NULL;  // list recording the patch indices with LocalID==0 to be udpated
    bool AllocateList = false; // whether to allocate PID0_List or not
@@ -193,6 +232,30 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
       for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
    } // if ( OverlapMPI ) ... else ...
 
+// pipeline the CPU solvers when there are at least two batches
+// --> exclude the Grackle solver since we are not sure whether the Grackle library supports nested OpenMP
+#  ifndef GPU
+   if ( OPT__PIPELINE_SOLVER  &&  NTotal > NPG_Max
+#       ifdef SUPPORT_GRACKLE
+        &&  TSolver != GRACKLE_SOLVER
+#       endif
+      )
+   {
+      Pipeline_Step( TSolver, lv, TimeNew, TimeOld, dt, Poi_Coeff, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                     NTotal, NPG_Max, PID0_List );
+
+      if ( OPT__AUTO_NPGROUP )
+      {
+         Timer_AutoNPG.Stop();
+         AutoNPG_Record( TSolver, lv, NPG_Cap, NPG_Max, NTotal, Timer_AutoNPG.GetValue() );
+      }
+
+      if ( AllocateList )  delete [] PID0_List;
+
+      return;
+   }
+#  endif
+
    NPG[ArrayID] = ( NPG_Max < NTotal ) ? NPG_Max : NTotal;
 
 
@@ -236,7 +299,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 //-------------------------------------------------------------------------------------------------------------
       TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
+                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt, TimeNew, TimeOld ),
                      Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -252,11 +315,17 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 //-------------------------------------------------------------------------------------------------------------
    TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
+                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt, TimeNew, TimeOld ),
                   Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
 
+   if ( OPT__AUTO_NPGROUP )
+   {
+      Timer_AutoNPG.Stop();
+      AutoNPG_Record( TSolver, lv, NPG_Cap, NPG_Max, NTotal, Timer_AutoNPG.GetValue() );
+   }
+
    if ( AllocateList )  delete [] PID0_List;
 
 } // FUNCTION : InvokeSolver
@@ -315,7 +384,7 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
    {
       case FLUID_SOLVER :
          Flu_Prepare( lv, TimeOld, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID],
-                      h_Pot_Array_USG_F[ArrayID], h_Corner_Array_F[ArrayID], NPG, PID0_List );
+                      h_Pot_Array_USG_F[ArrayID], h_Corner_Array_F[ArrayID], h_PriVar_F_In[ArrayID], NPG, PID0_List );
       break;
 
 #     ifdef GRAVITY
@@ -469,6 +538,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
    const bool   Flu_XYZ         = true;
    const double MINMOD_COEFF    = NULL_REAL;
    const int    MINMOD_MAX_ITER = NULL_INT;
+   const bool   MINMOD_LOCAL_FALLBACK = NULL_BOOL;
+   const int    FLU_TILE_NZ     = NULL_INT;
 #  else
    const bool   Flu_XYZ         = 1 - ( AdvanceCounter[lv]%2 );   // forward/backward sweep
 #  endif
@@ -551,9 +622,9 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
          CPU_FluidSolver       ( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID],
                                  h_Mag_Array_F_In[ArrayID], h_Mag_Array_F_Out[ArrayID],
                                  h_DE_Array_F_Out[ArrayID], h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                                 h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
+                                 h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID], h_PriVar_F_In[ArrayID],
                                  NPG, dt, dh, OPT__FIXUP_FLUX, OPT__FIXUP_ELECTRIC, Flu_XYZ,
-                                 OPT__LR_LIMITER, MINMOD_COEFF, MINMOD_MAX_ITER,
+                                 OPT__LR_LIMITER, MINMOD_COEFF, MINMOD_MAX_ITER, MINMOD_LOCAL_FALLBACK, FLU_TILE_NZ,
                                  ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
                                  TimeOld, (OPT__SELF_GRAVITY || OPT__EXT_POT), OPT__EXT_ACC,
                                  MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
@@ -753,9 +824,12 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
 //                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
+//                TimeNew    : Target physical time to reach (for SRC_FUSE_FLUID in Flu_Close())
+//                TimeOld    : Physical time before update (for SRC_FUSE_FLUID in Flu_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                   const int NPG, const int *PID0_List, const int ArrayID, const double dt )
+                   const int NPG, const int *PID0_List, const int ArrayID, const double dt,
+                   const double TimeNew, const double TimeOld )
 {
 
 #  ifndef DUAL_ENERGY
@@ -778,7 +852,7 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
       case FLUID_SOLVER :
          Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
                     h_Flu_Array_F_Out[ArrayID], h_Mag_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
-                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt );
+                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt, TimeNew, TimeOld );
       break;
 
 #     ifdef GRAVITY
@@ -826,3 +900,216 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 } // FUNCTION : Closing_Step
 
 
+
+#ifndef GPU
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pipeline_Step
+// Description :  Pipeline the preparation, execution, and closing steps of the CPU solvers
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__PIPELINE_SOLVER is on
+//                2. Split the OpenMP threads into two teams
+//                   --> PIPELINE_NTHREAD threads close batch N-1 and then prepare batch N+1, while the
+//                       remaining OMP_NTHREAD-PIPELINE_NTHREAD threads advance batch N
+//                   --> The two teams work on different ArrayID and thus do not share any host array
+//                   --> Load balance within each team relies on the OpenMP schedule of each step
+//                3. The closing step of batch N-1 still precedes the preparation step of batch N+1, and the
+//                   preparation step of batch N+1 still precedes the closing step of batch N
+//                   --> Same order of accessing the patch data as the serial version, so the results are identical
+//                4. Timers of individual steps are not supported
+//                   --> OPT__PIPELINE_SOLVER is disabled by TIMING_SOLVER
+//
+// Parameter   :  NTotal    : Total number of patch groups to be updated
+//                NPG_Max   : Maximum number of patch groups to be updated at a time
+//                PID0_List : List recording the patch indices with LocalID==0 to be udpated
+//                Others    : See InvokeSolver()
+//-------------------------------------------------------------------------------------------------------
+void Pipeline_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                    const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                    const int NTotal, const int NPG_Max, const int *PID0_List )
+{
+
+   const int NBatch = ( NTotal + NPG_Max - 1 ) / NPG_Max;
+
+// number of patch groups in the target batch
+#  define NPG_BATCH( b )   (  ( NPG_Max < NTotal-(b)*NPG_Max ) ? NPG_Max : NTotal-(b)*NPG_Max  )
+
+#  ifdef OPENMP
+   const int NThread_Side = PIPELINE_NTHREAD;
+   const int NThread_Sol  = OMP_NTHREAD - PIPELINE_NTHREAD;
+
+   omp_set_nested( true );
+#  endif
+
+
+// prepare the first batch
+   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG_BATCH(0), PID0_List, 0 );
+
+
+   for (int b=0; b<NBatch; b++)
+   {
+      const int ArrayID = b % 2;
+
+#     pragma omp parallel sections num_threads( 2 )
+      {
+//       advance batch b
+#        pragma omp section
+         {
+#           ifdef OPENMP
+            omp_set_num_threads( NThread_Sol );
+#           endif
+
+            Solver( TSolver, lv, TimeNew, TimeOld, NPG_BATCH(b), ArrayID, dt, Poi_Coeff );
+         }
+
+//       close batch b-1 and then prepare batch b+1
+#        pragma omp section
+         {
+#           ifdef OPENMP
+            omp_set_num_threads( NThread_Side );
+#           endif
+
+            if ( b > 0 )
+               Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                             NPG_BATCH(b-1), PID0_List+(b-1)*NPG_Max, 1-ArrayID, dt, TimeNew, TimeOld );
+
+            if ( b+1 < NBatch )
+               Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG_BATCH(b+1), PID0_List+(b+1)*NPG_Max, 1-ArrayID );
+         }
+      } // OpenMP parallel sections
+   } // for (int b=0; b<NBatch; b++)
+
+
+// close the last batch
+   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                 NPG_BATCH(NBatch-1), PID0_List+(NBatch-1)*NPG_Max, (NBatch-1)%2, dt, TimeNew, TimeOld );
+
+#  undef NPG_BATCH
+
+#  ifdef OPENMP
+   omp_set_nested( false );
+#  endif
+
+} // FUNCTION : Pipeline_Step
+#endif // #ifndef GPU
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AutoNPG_GetBatchSize
+// Description :  Return the number of patch groups to be sent into the target solver at a time for OPT__AUTO_NPGROUP
+//
+// Note        :  1. During the tuning phase, it returns the trial batch size currently being measured
+//                   --> Trial batch sizes are NPG_Cap, NPG_Cap/2, NPG_Cap/4, ... (see AutoNPG_Record())
+//                2. Afterwards, it returns the batch size with the lowest wall-clock time per patch group
+//                3. The returned value never exceeds NPG_Cap, which is the size of the allocated solver arrays
+//                   (i.e., FLU/POT/CHE/SRC_GPU_NPGROUP)
+//
+// Parameter   :  TSolver : Target solver
+//                lv      : Target refinement level
+//                NPG_Cap : Maximum number of patch groups allowed
+//
+// Return      :  Number of patch groups per batch
+//-------------------------------------------------------------------------------------------------------
+int AutoNPG_GetBatchSize( const Solver_t TSolver, const int lv, const int NPG_Cap )
+{
+
+   AutoNPG_t *Tune = &AutoNPG[lv][TSolver];
+
+// initialize the tuning state
+   if ( Tune->NPG <= 0 )
+   {
+      Tune->NPG      = NPG_Cap;
+      Tune->NSample  = 0;
+      Tune->NPGSum   = 0;
+      Tune->TimeSum  = 0.0;
+      Tune->BestNPG  = NPG_Cap;
+      Tune->BestCost = HUGE_NUMBER;
+      Tune->Done     = false;
+   }
+
+   return MIN( ( Tune->Done ) ? Tune->BestNPG : Tune->NPG, NPG_Cap );
+
+} // FUNCTION : AutoNPG_GetBatchSize
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AutoNPG_Record
+// Description :  Record the wall-clock time of one solver invocation for OPT__AUTO_NPGROUP and move on to
+//                the next trial batch size when enough samples have been collected
+//
+// Note        :  1. The cost of a trial batch size is the wall-clock time per patch group including the
+//                   preparation, execution, and closing steps, averaged over AutoNPG_NSample invocations
+//                   --> It is measured independently of the TIMING timers so that it also works without TIMING
+//                2. Invocations with no more patch groups than the current trial batch size are skipped since
+//                   they are advanced in a single batch and would cost the same with any larger batch size
+//                   --> Otherwise they would bias the cost comparison between trial batch sizes
+//                   --> Levels that never exceed NPG_Cap patch groups keep NPG_Cap
+//                3. Tuning stops when the cost increases or when the next trial batch size would be smaller
+//                   than the number of OpenMP threads (CPU) or CUDA streams (GPU)
+//                4. Each MPI rank tunes its own batch sizes. The results do not depend on the batch size.
+//
+// Parameter   :  TSolver : Target solver
+//                lv      : Target refinement level
+//                NPG_Cap : Maximum number of patch groups allowed
+//                NPG     : Number of patch groups per batch adopted in this invocation
+//                NTotal  : Total number of patch groups advanced in this invocation
+//                Time    : Wall-clock time of this invocation
+//-------------------------------------------------------------------------------------------------------
+void AutoNPG_Record( const Solver_t TSolver, const int lv, const int NPG_Cap, const int NPG, const int NTotal,
+                     const double Time )
+{
+
+   AutoNPG_t *Tune = &AutoNPG[lv][TSolver];
+
+   if ( Tune->Done )    return;
+
+#  ifdef GPU
+   const int NPG_Min = MIN( MAX( GPU_NSTREAM, 1 ), NPG_Cap );
+#  else
+   const int NPG_Min = MIN( MAX( OMP_NTHREAD, 1 ), NPG_Cap );
+#  endif
+
+   if ( NTotal <= NPG )    return;
+
+   Tune->NSample ++;
+   Tune->NPGSum  += NTotal;
+   Tune->TimeSum += Time;
+
+   if ( Tune->NSample < AutoNPG_NSample )    return;
+
+
+// evaluate the current trial batch size
+   const double Cost = Tune->TimeSum / Tune->NPGSum;
+   bool Stop = false;
+
+   if ( Cost < Tune->BestCost )
+   {
+      Tune->BestNPG  = NPG;
+      Tune->BestCost = Cost;
+   }
+   else
+      Stop = true;
+
+   if ( NPG/2 < NPG_Min )  Stop = true;
+
+
+// move on to the next trial batch size or fix the best one
+   if ( Stop )
+   {
+      Tune->Done = true;
+
+      if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+         Aux_Message( stdout, "   AutoNPG : solver %d, lv %2d --> %6d patch groups per batch (%13.7e s per patch group)\n",
+                      TSolver, lv, Tune->BestNPG, Tune->BestCost );
+   }
+
+   else
+   {
+      Tune->NPG     = NPG/2;
+      Tune->NSample = 0;
+      Tune->NPGSum  = 0;
+      Tune->TimeSum = 0.0;
+   }
+
+} // FUNCTION : AutoNPG_Record
@@ -13,6 +13,9 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 static void SetTargetSibling( int NTSib[], int *TSib[] );
 static int Table_01( const int SibID, const char dim, const int Count, const int GhostSize );
 static int Table_02( const int lv, const int PID, const int Side );
+static void CopyRow( real *Out, const real *In, const real *In_IntT, const int N, const bool IntTime,
+                     const real Weighting, const real Weighting_IntT );
+static const real *GetFluidGroupBlock( const int lv, const int Sg, const int PID0 );
 void SetTempIntPara( const int lv, const int Sg0, const double PrepTime, const double Time0, const double Time1,
                      bool &IntTime, int &Sg, int &Sg_IntT, real &Weighting, real &Weighting_IntT );
 #ifdef MHD
@@ -93,6 +96,9 @@ static void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const re
 //                           field on the coarse-fine interfaces of the central patch group
 //                       --> It's OK for the MHD solver since it will still guarantee that the updated B field within the patch group
 //                           is divergence free
+//               10. OutputPri is used by Flu_Prepare() for OPT__FLU_PREP_PRI
+//                   --> The conserved variables of each patch group are converted to primitive variables right after being
+//                       prepared, which saves the conversion in the MHM fluid solver
 //
 // Parameter   :  lv             : Target refinement level
 //                PrepTime       : Target physical time to prepare data
@@ -159,14 +165,19 @@ static void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const re
 //                                 when DUAL_ENERGY is on
 //                                 --> Only apply to the ghost-zone interpolation on the assumption that the data stored
 //                                     in all patches already satisfy this consistency check
+//                OutputPri      : Returned array to store the primitive variables converted from the prepared data (NULL --> off)
+//                                 --> Stored in the same layout as OutputCC
+//                                 --> HYDRO without MHD only, and must work with TVarCC == _TOTAL and PrepUnit == UNIT_PATCHGROUP
+//                                 --> Adopt the same parameters as the fluid solver for Hydro_Con2Pri() (e.g., MIN_PRES)
 //
-// Return      :  OutputCC, OutputFC
+// Return      :  OutputCC, OutputFC, OutputPri
 //-------------------------------------------------------------------------------------------------------
 void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, real *OutputFC,
                         const int GhostSize, const int NPG, const int *PID0_List, long TVarCC, long TVarFC,
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
                         const NSide_t NSide, const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
-                        const real MinDens, const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency )
+                        const real MinDens, const real MinPres, const real MinTemp, const real MinEntr, const bool DE_Consistency,
+                        real *OutputPri )
 {
 
 // nothing to do if there is no target patch group
@@ -242,6 +253,16 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #     endif
    }
 
+   if ( OutputPri != NULL )
+   {
+#     if ( MODEL == HYDRO  &&  !defined MHD )
+      if ( TVarCC != _TOTAL  ||  PrepUnit != UNIT_PATCHGROUP )
+         Aux_Error( ERROR_INFO, "OutputPri only works with TVarCC == _TOTAL and PrepUnit == UNIT_PATCHGROUP !!\n" );
+#     else
+      Aux_Error( ERROR_INFO, "OutputPri is only supported in HYDRO without MHD !!\n" );
+#     endif
+   }
+
    if ( IntPhase )
    {
 #     if ( MODEL == ELBDM )
@@ -335,6 +356,18 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
    const int    PGSize1D_FC      = PGSize1D_CC + 1;
    const int    PGSize3D_FC      = PGSize1D_FC*SQR(PGSize1D_CC);
 
+// parameters of the conserved-to-primitive conversion for OutputPri (same as those adopted in InvokeSolver())
+#  if ( MODEL == HYDRO  &&  !defined MHD )
+#  ifdef GRAVITY
+   const bool JeansMinPres       = JEANS_MIN_PRES;
+   const real JeansMinPres_Coeff = ( JEANS_MIN_PRES ) ?
+                                   NEWTON_G*SQR(JEANS_MIN_PRES_NCELL*amr->dh[JEANS_MIN_PRES_LEVEL])/(GAMMA*M_PI) : NULL_REAL;
+#  else
+   const bool JeansMinPres       = false;
+   const real JeansMinPres_Coeff = NULL_REAL;
+#  endif
+#  endif
+
 #  if   ( MODEL == HYDRO )
    const bool PrepVx           = ( TVarCC & _VELX    ) ? true : false;
    const bool PrepVy           = ( TVarCC & _VELY    ) ? true : false;
@@ -844,6 +877,43 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 //       a. fill out the central region of Data1PG_CC[]/FC[] (ghost zones will be filled out later)
 // ------------------------------------------------------------------------------------------------------------
+//       (a0) stream the fluid data of the whole patch group if it is stored in one block (see GetFluidGroupBlock())
+//            --> read the block sequentially in its storage order [LocalID][v][k][j][i] without looking up any patch
+         const real *FluPG      = ( NVarCC_Flu > 0 ) ? GetFluidGroupBlock( lv, FluSg, PID0 ) : NULL;
+         const real *FluPG_IntT = ( NVarCC_Flu > 0  &&  FluIntTime ) ? GetFluidGroupBlock( lv, FluSg_IntT, PID0 ) : FluPG;
+         const bool  StreamPG   = ( FluPG != NULL  &&  FluPG_IntT != NULL );
+
+         if ( StreamPG )
+         {
+            for (int LocalID=0; LocalID<8; LocalID++ )
+            {
+               const int Disp_i = TABLE_02( LocalID, 'x', GhostSize, GhostSize+PS1 );
+               const int Disp_j = TABLE_02( LocalID, 'y', GhostSize, GhostSize+PS1 );
+               const int Disp_k = TABLE_02( LocalID, 'z', GhostSize, GhostSize+PS1 );
+
+               Data1PG_CC_Ptr = Data1PG_CC;
+
+               for (int v=0; v<NVarCC_Flu; v++)
+               {
+                  const long  Offset   = ( (long)LocalID*NCOMP_TOTAL + TVarCCIdxList_Flu[v] )*CUBE(PS1);
+                  const real *Flu      = FluPG      + Offset;
+                  const real *Flu_IntT = FluPG_IntT + Offset;
+
+                  for (int k=0; k<PS1; k++)  {  K    = k + Disp_k;
+                  for (int j=0; j<PS1; j++)  {  J    = j + Disp_j;
+                                                Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
+
+                     CopyRow( Data1PG_CC_Ptr+Idx1, Flu, Flu_IntT, PS1, FluIntTime, FluWeighting, FluWeighting_IntT );
+
+                     Flu      += PS1;
+                     Flu_IntT += PS1;
+                  }}
+
+                  Data1PG_CC_Ptr += PGSize3D_CC;
+               }
+            } // for (int LocalID=0; LocalID<8; LocalID++ )
+         } // if ( StreamPG )
+
          for (int LocalID=0; LocalID<8; LocalID++ )
          {
             const int PID    = PID0 + LocalID;
@@ -855,22 +925,25 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
             Data1PG_FC_Ptr = Data1PG_FC;
 
 //          (a1) fluid data (cell-centered)
+//               --> already copied by (a0) if StreamPG is on
+            if ( StreamPG )   Data1PG_CC_Ptr += NVarCC_Flu*PGSize3D_CC;
+
+            else
             for (int v=0; v<NVarCC_Flu; v++)
             {
                TVarCCIdx_Flu = TVarCCIdxList_Flu[v];
 
+//             look up the patch data only once since the compiler cannot assume that they do not alias with Data1PG_CC[]
+               const real *Flu      =                 amr->patch[FluSg     ][lv][PID]->fluid[TVarCCIdx_Flu][0][0];
+               const real *Flu_IntT = ( FluIntTime ) ? amr->patch[FluSg_IntT][lv][PID]->fluid[TVarCCIdx_Flu][0][0] : Flu;
+
                for (int k=0; k<PS1; k++)  {  K    = k + Disp_k;
                for (int j=0; j<PS1; j++)  {  J    = j + Disp_j;
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
-               for (int i=0; i<PS1; i++)  {
+                                             Idx2 = IDX321(      0, j, k, PS1,         PS1         );
 
-                  Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][PID]->fluid[TVarCCIdx_Flu][k][j][i];
-
-                  if ( FluIntTime ) // temporal interpolation
-                  Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                         + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][PID]->fluid[TVarCCIdx_Flu][k][j][i];
-                  Idx1 ++;
-               }}}
+                  CopyRow( Data1PG_CC_Ptr+Idx1, Flu+Idx2, Flu_IntT+Idx2, PS1, FluIntTime, FluWeighting, FluWeighting_IntT );
+               }}
 
                Data1PG_CC_Ptr += PGSize3D_CC;
             }
@@ -878,6 +951,11 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 //          (a2) derived variables (cell-centered)
 #           if   ( MODEL == HYDRO )
+//          load the patch pointers once instead of looking up the patch table in every cell
+//          --> FluSg and FluSg_IntT are set only when fluid or derived variables are prepared
+            const real (*Fluid     )[PS1][PS1][PS1] = ( NVarCC_Der != 0 ) ? amr->patch[FluSg][lv][PID]->fluid : NULL;
+            const real (*Fluid_IntT)[PS1][PS1][PS1] = ( NVarCC_Der != 0  &&  FluIntTime ) ? amr->patch[FluSg_IntT][lv][PID]->fluid : NULL;
+
             if ( PrepVx )
             {
                for (int k=0; k<PS1; k++)  {  K    = k + Disp_k;
@@ -885,13 +963,13 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
                for (int i=0; i<PS1; i++)  {
 
-                  Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][PID]->fluid[MOMX][k][j][i] /
-                                         amr->patch[FluSg][lv][PID]->fluid[DENS][k][j][i];
+                  Data1PG_CC_Ptr[Idx1] = Fluid[MOMX][k][j][i] /
+                                         Fluid[DENS][k][j][i];
 
                   if ( FluIntTime ) // temporal interpolation
                   Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                         + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMX][k][j][i] /
-                                                               amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k][j][i] );
+                                         + FluWeighting_IntT*( Fluid_IntT[MOMX][k][j][i] /
+                                                               Fluid_IntT[DENS][k][j][i] );
                   Idx1 ++;
                }}}
 
@@ -905,13 +983,13 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                                       Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
                for (int i=0; i<PS1; i++)    {
 
-                  Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][PID]->fluid[MOMY][k][j][i] /
-                                         amr->patch[FluSg][lv][PID]->fluid[DENS][k][j][i];
+                  Data1PG_CC_Ptr[Idx1] = Fluid[MOMY][k][j][i] /
+                                         Fluid[DENS][k][j][i];
 
                   if ( FluIntTime ) // temporal interpolation
                   Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                         + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMY][k][j][i] /
-                                                               amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k][j][i] );
+                                         + FluWeighting_IntT*( Fluid_IntT[MOMY][k][j][i] /
+                                                               Fluid_IntT[DENS][k][j][i] );
                   Idx1 ++;
                }}}
 
@@ -925,13 +1003,13 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
                for (int i=0; i<PS1; i++)  {
 
-                  Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][PID]->fluid[MOMZ][k][j][i] /
-                                         amr->patch[FluSg][lv][PID]->fluid[DENS][k][j][i];
+                  Data1PG_CC_Ptr[Idx1] = Fluid[MOMZ][k][j][i] /
+                                         Fluid[DENS][k][j][i];
 
                   if ( FluIntTime ) // temporal interpolation
                   Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                         + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][PID]->fluid[MOMZ][k][j][i] /
-                                                               amr->patch[FluSg_IntT][lv][PID]->fluid[DENS][k][j][i] );
+                                         + FluWeighting_IntT*( Fluid_IntT[MOMZ][k][j][i] /
+                                                               Fluid_IntT[DENS][k][j][i] );
                   Idx1 ++;
                }}}
 
@@ -945,7 +1023,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
                for (int i=0; i<PS1; i++)  {
 
-                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][PID]->fluid[v][k][j][i];
+                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k][j][i];
 
 #                 ifdef MHD
                   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg );
@@ -960,7 +1038,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
                   if ( FluIntTime ) // temporal interpolation
                   {
-                     for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k][j][i];
+                     for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k][j][i];
 
 #                    ifdef MHD
                      const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg_IntT );
@@ -989,7 +1067,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
                for (int i=0; i<PS1; i++)  {
 
-                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][PID]->fluid[v][k][j][i];
+                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k][j][i];
 
 #                 ifdef MHD
                   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg );
@@ -1004,7 +1082,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
                   if ( FluIntTime ) // temporal interpolation
                   {
-                     for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k][j][i];
+                     for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k][j][i];
 
 #                    ifdef MHD
                      const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg_IntT );
@@ -1033,7 +1111,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
                for (int i=0; i<PS1; i++)  {
 
-                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][PID]->fluid[v][k][j][i];
+                  for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][k][j][i];
 
 #                 ifdef MHD
                   const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg );
@@ -1048,7 +1126,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
                   if ( FluIntTime ) // temporal interpolation
                   {
-                     for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][PID]->fluid[v][k][j][i];
+                     for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][k][j][i];
 
 #                    ifdef MHD
                      const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg_IntT );
@@ -1142,18 +1220,16 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 //          (a3) potential data (cell-centered)
             if ( PrepPot )
             {
+               const real *Pot      =                 amr->patch[PotSg     ][lv][PID]->pot[0][0];
+               const real *Pot_IntT = ( PotIntTime ) ? amr->patch[PotSg_IntT][lv][PID]->pot[0][0] : Pot;
+
                for (int k=0; k<PS1; k++)  {  K    = k + Disp_k;
                for (int j=0; j<PS1; j++)  {  J    = j + Disp_j;
                                              Idx1 = IDX321( Disp_i, J, K, PGSize1D_CC, PGSize1D_CC );
-               for (int i=0; i<PS1; i++)  {
-
-                  Data1PG_CC_Ptr[Idx1] = amr->patch[PotSg][lv][PID]->pot[k][j][i];
+                                             Idx2 = IDX321(      0, j, k, PS1,         PS1         );
 
-                  if ( PotIntTime ) // temporal interpolation
-                  Data1PG_CC_Ptr[Idx1] =   PotWeighting     *Data1PG_CC_Ptr[Idx1]
-                                         + PotWeighting_IntT*amr->patch[PotSg_IntT][lv][PID]->pot[k][j][i];
-                  Idx1 ++;
-               }}}
+                  CopyRow( Data1PG_CC_Ptr+Idx1, Pot+Idx2, Pot_IntT+Idx2, PS1, PotIntTime, PotWeighting, PotWeighting_IntT );
+               }}
 
                Data1PG_CC_Ptr += PGSize3D_CC;
             } // if ( PrepPot )
@@ -1194,20 +1270,17 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 //             copy data
+               const real *Mag      =                 amr->patch[MagSg     ][lv][PID]->magnetic[TVarFCIdx];
+               const real *Mag_IntT = ( MagIntTime ) ? amr->patch[MagSg_IntT][lv][PID]->magnetic[TVarFCIdx] : Mag;
+
                for (int k=ijk_s[2]; k<ijk_e[2]; k++)  {  K     = k + Disp_k;
                for (int j=ijk_s[1]; j<ijk_e[1]; j++)  {  J     = j + Disp_j;
                                                          idx_o = IDX321( ijk_s[0]+Disp_i, J, K, size_o[0], size_o[1] );
                                                          idx_i = IDX321( ijk_s[0],        j, k, size_i[0], size_i[1] );
-               for (int i=ijk_s[0]; i<ijk_e[0]; i++)  {
 
-                  Data1PG_FC_Ptr[idx_o] = amr->patch[MagSg][lv][PID]->magnetic[TVarFCIdx][idx_i];
-
-                  if ( MagIntTime ) // temporal interpolation
-                  Data1PG_FC_Ptr[idx_o] =   MagWeighting     *Data1PG_FC_Ptr[idx_o]
-                                          + MagWeighting_IntT*amr->patch[MagSg_IntT][lv][PID]->magnetic[TVarFCIdx][idx_i];
-                  idx_i ++;
-                  idx_o ++;
-               }}}
+                  CopyRow( Data1PG_FC_Ptr+idx_o, Mag+idx_i, Mag_IntT+idx_i, ijk_e[0]-ijk_s[0], MagIntTime,
+                           MagWeighting, MagWeighting_IntT );
+               }}
 
 #              else
                Aux_Error( ERROR_INFO, "currently only MHD supports face-centered variables !!" );
@@ -1257,20 +1330,16 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                   {
                      TVarCCIdx_Flu = TVarCCIdxList_Flu[v];
 
+                     const real *Flu      =                 amr->patch[FluSg     ][lv][SibPID]->fluid[TVarCCIdx_Flu][0][0];
+                     const real *Flu_IntT = ( FluIntTime ) ? amr->patch[FluSg_IntT][lv][SibPID]->fluid[TVarCCIdx_Flu][0][0] : Flu;
+
                      for (int k=0; k<loop[2]; k++)  { K = k + disp[2];   K2 = k + disp2[2];
                      for (int j=0; j<loop[1]; j++)  { J = j + disp[1];   J2 = j + disp2[1];
-                                                      Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
-                     for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
-
-                        Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][SibPID]->fluid[TVarCCIdx_Flu][K2][J2][I2];
-
-                        if ( FluIntTime ) // temporal interpolation
-                        Data1PG_CC_Ptr[Idx1] =
-                           FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                         + FluWeighting_IntT*amr->patch[FluSg_IntT][lv][SibPID]->fluid[TVarCCIdx_Flu][K2][J2][I2];
+                                                      Idx1 = IDX321( disp[0],  J,  K,  PGSize1D_CC, PGSize1D_CC );
+                                                      Idx2 = IDX321( disp2[0], J2, K2, PS1,         PS1         );
 
-                        Idx1 ++;
-                     }}}
+                        CopyRow( Data1PG_CC_Ptr+Idx1, Flu+Idx2, Flu_IntT+Idx2, loop[0], FluIntTime, FluWeighting, FluWeighting_IntT );
+                     }}
 
                      Data1PG_CC_Ptr += PGSize3D_CC;
                   } // for (int v=0; v<NVarCC_Flu; v++)
@@ -1278,6 +1347,11 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 //                (b1-2) derived variables (cell-centered)
 #                 if   ( MODEL == HYDRO )
+//                load the patch pointers once instead of looking up the patch table in every cell
+//                --> FluSg and FluSg_IntT are set only when fluid or derived variables are prepared
+                  const real (*Fluid     )[PS1][PS1][PS1] = ( NVarCC_Der != 0 ) ? amr->patch[FluSg][lv][SibPID]->fluid : NULL;
+                  const real (*Fluid_IntT)[PS1][PS1][PS1] = ( NVarCC_Der != 0  &&  FluIntTime ) ? amr->patch[FluSg_IntT][lv][SibPID]->fluid : NULL;
+
                   if ( PrepVx )
                   {
                      for (int k=0; k<loop[2]; k++)  { K = k + disp[2];   K2 = k + disp2[2];
@@ -1285,13 +1359,13 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                                       Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
                      for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
 
-                        Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][SibPID]->fluid[MOMX][K2][J2][I2] /
-                                               amr->patch[FluSg][lv][SibPID]->fluid[DENS][K2][J2][I2];
+                        Data1PG_CC_Ptr[Idx1] = Fluid[MOMX][K2][J2][I2] /
+                                               Fluid[DENS][K2][J2][I2];
 
                         if ( FluIntTime ) // temporal interpolation
                         Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                               + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMX][K2][J2][I2] /
-                                                                     amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][K2][J2][I2] );
+                                               + FluWeighting_IntT*( Fluid_IntT[MOMX][K2][J2][I2] /
+                                                                     Fluid_IntT[DENS][K2][J2][I2] );
                         Idx1 ++;
                      }}}
 
@@ -1305,13 +1379,13 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                                       Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
                      for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
 
-                        Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][SibPID]->fluid[MOMY][K2][J2][I2] /
-                                               amr->patch[FluSg][lv][SibPID]->fluid[DENS][K2][J2][I2];
+                        Data1PG_CC_Ptr[Idx1] = Fluid[MOMY][K2][J2][I2] /
+                                               Fluid[DENS][K2][J2][I2];
 
                         if ( FluIntTime ) // temporal interpolation
                         Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                               + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMY][K2][J2][I2] /
-                                                                     amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][K2][J2][I2] );
+                                               + FluWeighting_IntT*( Fluid_IntT[MOMY][K2][J2][I2] /
+                                                                     Fluid_IntT[DENS][K2][J2][I2] );
                         Idx1 ++;
                      }}}
 
@@ -1325,13 +1399,13 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                                       Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
                      for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
 
-                        Data1PG_CC_Ptr[Idx1] = amr->patch[FluSg][lv][SibPID]->fluid[MOMZ][K2][J2][I2] /
-                                               amr->patch[FluSg][lv][SibPID]->fluid[DENS][K2][J2][I2];
+                        Data1PG_CC_Ptr[Idx1] = Fluid[MOMZ][K2][J2][I2] /
+                                               Fluid[DENS][K2][J2][I2];
 
                         if ( FluIntTime ) // temporal interpolation
                         Data1PG_CC_Ptr[Idx1] =   FluWeighting     *Data1PG_CC_Ptr[Idx1]
-                                               + FluWeighting_IntT*( amr->patch[FluSg_IntT][lv][SibPID]->fluid[MOMZ][K2][J2][I2] /
-                                                                     amr->patch[FluSg_IntT][lv][SibPID]->fluid[DENS][K2][J2][I2] );
+                                               + FluWeighting_IntT*( Fluid_IntT[MOMZ][K2][J2][I2] /
+                                                                     Fluid_IntT[DENS][K2][J2][I2] );
                         Idx1 ++;
                      }}}
 
@@ -1345,7 +1419,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                                       Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
                      for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
 
-                        for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][SibPID]->fluid[v][K2][J2][I2];
+                        for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][K2][J2][I2];
 
 #                       ifdef MHD
                         const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, I2, J2, K2, MagSg );
@@ -1360,7 +1434,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
                         if ( FluIntTime ) // temporal interpolation
                         {
-                           for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][K2][J2][I2];
+                           for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][K2][J2][I2];
 
 #                          ifdef MHD
                            const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, I2, J2, K2, MagSg_IntT );
@@ -1389,7 +1463,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                                       Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
                      for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
 
-                        for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][SibPID]->fluid[v][K2][J2][I2];
+                        for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][K2][J2][I2];
 
 #                       ifdef MHD
                         const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, I2, J2, K2, MagSg );
@@ -1404,7 +1478,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
                         if ( FluIntTime ) // temporal interpolation
                         {
-                           for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][K2][J2][I2];
+                           for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][K2][J2][I2];
 
 #                          ifdef MHD
                            const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, I2, J2, K2, MagSg_IntT );
@@ -1433,7 +1507,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
                                                       Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
                      for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
 
-                        for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg][lv][SibPID]->fluid[v][K2][J2][I2];
+                        for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid[v][K2][J2][I2];
 
 #                       ifdef MHD
                         const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, I2, J2, K2, MagSg );
@@ -1448,7 +1522,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
                         if ( FluIntTime ) // temporal interpolation
                         {
-                           for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = amr->patch[FluSg_IntT][lv][SibPID]->fluid[v][K2][J2][I2];
+                           for (int v=0; v<NFluForEoS; v++)    FluidForEoS[v] = Fluid_IntT[v][K2][J2][I2];
 
 #                          ifdef MHD
                            const real Emag = MHD_GetCellCenteredBEnergyInPatch( lv, SibPID, I2, J2, K2, MagSg_IntT );
@@ -1541,18 +1615,16 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 //                (b1-3) potential data (cell-centered)
                   if ( PrepPot )
                   {
+                     const real *Pot      =                 amr->patch[PotSg     ][lv][SibPID]->pot[0][0];
+                     const real *Pot_IntT = ( PotIntTime ) ? amr->patch[PotSg_IntT][lv][SibPID]->pot[0][0] : Pot;
+
                      for (int k=0; k<loop[2]; k++)  { K = k + disp[2];   K2 = k + disp2[2];
                      for (int j=0; j<loop[1]; j++)  { J = j + disp[1];   J2 = j + disp2[1];
-                                                      Idx1 = IDX321( disp[0], J, K, PGSize1D_CC, PGSize1D_CC );
-                     for (I2=disp2[0]; I2<disp2[0]+loop[0]; I2++) {
+                                                      Idx1 = IDX321( disp[0],  J,  K,  PGSize1D_CC, PGSize1D_CC );
+                                                      Idx2 = IDX321( disp2[0], J2, K2, PS1,         PS1         );
 
-                        Data1PG_CC_Ptr[Idx1] = amr->patch[PotSg][lv][SibPID]->pot[K2][J2][I2];
-
-                        if ( PotIntTime ) // temporal interpolation
-                        Data1PG_CC_Ptr[Idx1] =   PotWeighting     *Data1PG_CC_Ptr[Idx1]
-                                               + PotWeighting_IntT*amr->patch[PotSg_IntT][lv][SibPID]->pot[K2][J2][I2];
-                        Idx1 ++;
-                     }}}
+                        CopyRow( Data1PG_CC_Ptr+Idx1, Pot+Idx2, Pot_IntT+Idx2, loop[0], PotIntTime, PotWeighting, PotWeighting_IntT );
+                     }}
 
                      Data1PG_CC_Ptr += PGSize3D_CC;
                   } // if ( PrepPot )
@@ -1599,22 +1671,17 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 //                   copy data
+                     const real *Mag      =                 amr->patch[MagSg     ][lv][SibPID]->magnetic[TVarFCIdx];
+                     const real *Mag_IntT = ( MagIntTime ) ? amr->patch[MagSg_IntT][lv][SibPID]->magnetic[TVarFCIdx] : Mag;
+
                      for (int k=ijk_s[2]; k<ijk_e[2]; k++)  {  K     = k + disp_o[2];
                      for (int j=ijk_s[1]; j<ijk_e[1]; j++)  {  J     = j + disp_o[1];
                                                                idx_o = IDX321( ijk_s[0]+disp_o[0], J, K, size_o[0], size_o[1] );
                                                                idx_i = IDX321( ijk_s[0],           j, k, size_i[0], size_i[1] );
-                     for (int i=ijk_s[0]; i<ijk_e[0]; i++)  {
 
-                        Data1PG_FC_Ptr[idx_o] = amr->patch[MagSg][lv][SibPID]->magnetic[TVarFCIdx][idx_i];
-
-                        if ( MagIntTime ) // temporal interpolation
-                        Data1PG_FC_Ptr[idx_o] =
-                           MagWeighting     *Data1PG_FC_Ptr[idx_o]
-                         + MagWeighting_IntT*amr->patch[MagSg_IntT][lv][SibPID]->magnetic[TVarFCIdx][idx_i];
-
-                        idx_i ++;
-                        idx_o ++;
-                     }}}
+                        CopyRow( Data1PG_FC_Ptr+idx_o, Mag+idx_i, Mag_IntT+idx_i, ijk_e[0]-ijk_s[0], MagIntTime,
+                                 MagWeighting, MagWeighting_IntT );
+                     }}
 
 #                    else
                      Aux_Error( ERROR_INFO, "currently only MHD supports face-centered variables !!" );
@@ -2135,6 +2202,29 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #        endif
 
 
+//       (d3) conserved --> primitive variables while the data of this patch group are still in cache
+//       --> must be consistent with the conversion in the fluid solver (see Hydro_DataReconstruction())
+#        if ( MODEL == HYDRO  &&  !defined MHD )
+         if ( OutputPri != NULL )
+         {
+            real *Data1PG_Pri = OutputPri + TID*NCOMP_TOTAL*PGSize3D_CC;
+            real ConVar_1Cell[NCOMP_TOTAL], PriVar_1Cell[NCOMP_TOTAL];
+
+            for (int t=0; t<PGSize3D_CC; t++)
+            {
+               for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = Data1PG_CC[ v*PGSize3D_CC + t ];
+
+               Hydro_Con2Pri( ConVar_1Cell, PriVar_1Cell, MIN_PRES,
+                              OPT__INT_FRAC_PASSIVE_LR, PassiveIntFrac_NVar, PassiveIntFrac_VarIdx,
+                              JeansMinPres, JeansMinPres_Coeff, EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr,
+                              EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
+
+               for (int v=0; v<NCOMP_TOTAL; v++)   Data1PG_Pri[ v*PGSize3D_CC + t ] = PriVar_1Cell[v];
+            }
+         } // if ( OutputPri != NULL )
+#        endif // #if ( MODEL == HYDRO  &&  !defined MHD )
+
+
 //       e. copy data from Data1PG_CC[] to OutputCC[]
 // ------------------------------------------------------------------------------------------------------------
          if ( PrepUnit == UNIT_PATCH ) // separate the prepared patch group data into individual patches
@@ -2345,6 +2435,72 @@ void SetTempIntPara( const int lv, const int Sg0, const double PrepTime, const d
 // |  Tables  |
 // ============
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CopyRow
+// Description :  Copy one contiguous row of patch data to the patch-group array, with optional temporal interpolation
+//
+// Note        :  1. Invoked by Prepare_PatchData() for the interior and sibling ghost-zone data
+//                2. Rows are contiguous in both the patch and patch-group arrays, so the copy reduces to a streaming
+//                   memcpy() when temporal interpolation is not required
+//                3. The temporally interpolated result is identical to the original two-step assignment
+//                   Out = In; Out = Weighting*Out + Weighting_IntT*In_IntT;
+//
+// Parameter   :  Out            : Output array
+//                In             : Input array of the data stored in Sg
+//                In_IntT        : Input array of the data stored in Sg_IntT (useless if IntTime == false)
+//                N              : Number of elements to be copied
+//                IntTime        : Whether or not to apply temporal interpolation
+//                Weighting      : Weighting for In[]
+//                Weighting_IntT : Weighting for In_IntT[]
+//-------------------------------------------------------------------------------------------------------
+void CopyRow( real *Out, const real *In, const real *In_IntT, const int N, const bool IntTime,
+              const real Weighting, const real Weighting_IntT )
+{
+
+   if ( IntTime )
+      for (int i=0; i<N; i++)    Out[i] = Weighting*In[i] + Weighting_IntT*In_IntT[i];
+
+   else
+      memcpy( Out, In, N*sizeof(real) );
+
+} // FUNCTION : CopyRow
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetFluidGroupBlock
+// Description :  Return the fluid block shared by the eight patches of a patch group if they are stored contiguously
+//
+// Note        :  1. Invoked by Prepare_PatchData()
+//                2. PatchArena_AllocGroup() stores the fluid arrays of a patch group in one block of
+//                   8*NCOMP_TOTAL*PS1^3 elements for each Sg
+//                   --> The fluid array of LocalID is at Block + LocalID*NCOMP_TOTAL*PS1^3
+//                   --> Verify it directly since the block may be split by OPT__PATCH_ARENA=0 or by
+//                       moving the arrays between patches (e.g., LB_Refine_AllocateNewPatch())
+//
+// Parameter   :  lv   : Target refinement level
+//                Sg   : Sandglass of the fluid data
+//                PID0 : Patch index with LocalID == 0
+//
+// Return      :  Pointer to the group block, or NULL if the patch group is not stored contiguously
+//-------------------------------------------------------------------------------------------------------
+const real *GetFluidGroupBlock( const int lv, const int Sg, const int PID0 )
+{
+
+   const real *Block = (const real*)amr->patch[Sg][lv][PID0]->fluid;
+
+   if ( Block == NULL )    return NULL;
+
+   for (int LocalID=1; LocalID<8; LocalID++)
+      if ( (const real*)amr->patch[Sg][lv][PID0+LocalID]->fluid != Block + LocalID*NCOMP_TOTAL*CUBE(PS1) )
+         return NULL;
+
+   return Block;
+
+} // FUNCTION : GetFluidGroupBlock
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Table_01
 // Description :  Return the displacement for Prepare_PatchData()
@@ -3077,12 +3233,8 @@ void Prepare_PatchData_FreeParticleDensityArray( const int lv )
    if ( ! OPT__REUSE_MEMORY )
    for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
    {
-      if ( amr->patch[0][lv][PID]->rho_ext != NULL )
-      {
-         delete [] amr->patch[0][lv][PID]->rho_ext;
-
-         amr->patch[0][lv][PID]->rho_ext = NULL;
-      }
+//    rho_ext[] is allocated by patch_t::dnew() and must be released by the corresponding patch_t::ddelete()
+      if ( amr->patch[0][lv][PID]->rho_ext != NULL )  amr->patch[0][lv][PID]->ddelete();
    }
 
 // set flag to false to indicate that Prepare_PatchData_InitParticleDensityArray() has not been called
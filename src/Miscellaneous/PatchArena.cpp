@@ -0,0 +1,724 @@
+#include "GAMER.h"
+#include <sys/mman.h>
+
+
+static const int     Arena_NClassMax = 32;
+static const size_t  Arena_Align     = 64;
+static const int     Arena_PageBit   = 21;                  // 2 MB = size of a transparent huge page on x86-64
+static const size_t  Arena_SlabAlign = 1UL << Arena_PageBit;
+static const int     Arena_MinChunk  = 64;                  // minimum number of patches per slab (i.e., 8 patch groups)
+static const int     Arena_GroupSize = 8;                   // number of patches in a patch group
+static const int     Arena_AddrBit   = 48;                  // number of bits of a virtual address
+static const int     Arena_LeafBit   = 14;                  // number of address bits resolved by a leaf of the page map
+
+// large block of memory divided into chunks of the same size class
+struct ArenaSlab_t
+{
+   char          *Base;       // start address of the slab
+   size_t         NByte;      // total size of the slab
+   int            NChunk;     // number of chunks
+   int            NFree;      // number of entries in FreeList[]
+   int           *FreeList;   // stack of free chunk indices (popped in ascending address order for a new slab)
+   unsigned char *NLive;      // number of slices in use in each chunk (for the group classes only)
+   int            Owner;      // index of the thread arena owning the slab
+   int            Class;      // size class of the slab in the owner arena
+   int            Index;      // index of the slab in ArenaClass_t::Slab[]
+};
+
+// block of a group class currently handing out slices to a patch group
+struct ArenaOpen_t
+{
+   ArenaSlab_t *Slab;         // NULL --> no block is open
+   int          Chunk;        // index of the block in the slab
+   int          Next;         // smallest LocalID that can still be handed out from this block
+};
+
+// all slabs of a given chunk size
+// --> for a group class, each chunk is a block of Arena_GroupSize slices shared by the patches of a patch group
+struct ArenaClass_t
+{
+   size_t        Size;        // chunk (or slice) size requested by the caller
+   bool          Group;       // true --> group class
+   size_t        Slice;       // distance between adjacent slices (aligned)
+   size_t        Stride;      // distance between adjacent chunks (= Slice or Arena_GroupSize*Slice)
+   int           NSlab;
+   int           NSlabAlloc;
+   ArenaSlab_t **Slab;
+   int           FirstAvail;  // no slab before this index has any free chunk
+   long          NUsed;       // number of chunks in use
+   ArenaOpen_t   Open[2];     // open block of each sandglass (for the group classes only)
+};
+
+// size classes of a single thread
+struct Arena_t
+{
+   int           NClass;
+   ArenaClass_t  Class[Arena_NClassMax];
+#  ifdef OPENMP
+   omp_lock_t    Lock;        // protect all slabs of this arena since chunks can be freed by other threads
+#  endif
+};
+
+static int           Arena_NThread   = 0;
+static Arena_t      *Arena           = NULL;
+static ArenaSlab_t **Arena_Map[ 1L << (Arena_AddrBit-Arena_PageBit-Arena_LeafBit) ];   // 2 MB page -> slab
+
+static int          GetClass( Arena_t *A, const size_t Size, const bool Group );
+static ArenaSlab_t *TakeChunk( Arena_t *A, ArenaClass_t *Class, int &Chunk );
+static void         ReleaseChunk( ArenaClass_t *Class, ArenaSlab_t *Slab, const int Chunk );
+static void         CloseBlock( ArenaClass_t *Class, const int Sg );
+static ArenaSlab_t *NewSlab( Arena_t *A, const int c );
+static void         DeleteSlab( ArenaSlab_t *Slab );
+static void         MapSlab( ArenaSlab_t *Slab, ArenaSlab_t *Target );
+static ArenaSlab_t *FindSlab( const void *Ptr );
+static Arena_t     *LockArena( const int Owner );
+static void         UnlockArena( Arena_t *A );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchArena_Init
+// Description :  Initialize the patch arena
+//
+// Note        :  1. Invoked by Init_GAMER() after Init_OpenMP() and before allocating any patch
+//                2. Each OpenMP thread owns an arena with its own size classes and slabs
+//                   --> Allocation only locks the arena of the calling thread and thus rarely contends
+//                   --> Slab pages are first touched by the owner thread, so they are placed on its NUMA node
+//                       as long as threads are pinned (e.g., OMP_PROC_BIND)
+//                3. Do nothing if OPT__PATCH_ARENA is off
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void PatchArena_Init()
+{
+
+   if ( ! OPT__PATCH_ARENA )  return;
+
+
+#  ifdef OPENMP
+   Arena_NThread = MAX( OMP_NTHREAD, 1 );
+#  else
+   Arena_NThread = 1;
+#  endif
+
+   Arena = new Arena_t [Arena_NThread];
+
+   for (int t=0; t<Arena_NThread; t++)
+   {
+      Arena[t].NClass = 0;
+#     ifdef OPENMP
+      omp_init_lock( &Arena[t].Lock );
+#     endif
+   }
+
+} // FUNCTION : PatchArena_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchArena_Alloc
+// Description :  Allocate the data arrays of a patch (e.g., fluid[], pot[], flux[]) from the patch arena
+//
+// Note        :  1. Invoked by the allocators of patch_t (e.g., hnew(), gnew(), fnew())
+//                2. Use malloc() directly if OPT__PATCH_ARENA is off
+//                3. Chunks of the same size are carved out of large slabs
+//                   --> Slabs are aligned to and padded to multiples of 2 MB and advised to use transparent
+//                       huge pages
+//                   --> Slabs are obtained from mmap() and not touched until the chunks are used
+//                   --> A new slab holds at least Arena_MinChunk patches and grows with the number of chunks
+//                       in use (by 1/8)
+//                4. Chunks carry no header; PatchArena_Free() locates the slab of a chunk from a page map
+//                   --> A new slab hands out its chunks in ascending address order with no gap in between, but
+//                       chunks freed and reused later are not necessarily contiguous
+//                   --> Use PatchArena_AllocGroup() to guarantee contiguity within a patch group
+//                5. Allocate from the oldest slab with free chunks so that newer slabs are more likely to become
+//                   empty and released by PatchArena_Shrink()
+//                6. Thread-safe
+//
+// Parameter   :  Size : Number of bytes to be allocated
+//
+// Return      :  Pointer to the allocated memory
+//-------------------------------------------------------------------------------------------------------
+void *PatchArena_Alloc( const size_t Size )
+{
+
+   if ( ! OPT__PATCH_ARENA )  return malloc( Size );
+
+
+#  ifdef OPENMP
+   Arena_t      *A     = LockArena( omp_get_thread_num() % Arena_NThread );
+#  else
+   Arena_t      *A     = LockArena( 0 );
+#  endif
+   ArenaClass_t *Class = A->Class + GetClass( A, Size, false );
+
+   int          Chunk;
+   ArenaSlab_t *Slab = TakeChunk( A, Class, Chunk );
+   void        *Ptr  = Slab->Base + Chunk*Class->Stride;
+
+   UnlockArena( A );
+
+   return Ptr;
+
+} // FUNCTION : PatchArena_Alloc
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchArena_AllocGroup
+// Description :  Allocate a data array of a patch as a slice of a block shared by its patch group
+//
+// Note        :  1. Invoked by amr->pnew() through patch_t::hnew() to allocate fluid[]
+//                2. Use malloc() directly if OPT__PATCH_ARENA is off
+//                3. Each block stores the arrays of the Arena_GroupSize patches of a patch group in a single
+//                   sandglass back to back
+//                   --> Slice "LocalID" starts at the block base + LocalID*Size when Size is a multiple of
+//                       Arena_Align, which holds for fluid[]
+//                   --> A new block is opened for LocalID = 0 or when the slice of LocalID has been handed out
+//                       already, so the 8 patches of a group allocated in order by the same thread share a block
+//                   --> Each thread and sandglass has its own open block, so patch groups allocated in parallel
+//                       (e.g., Refine()) do not interleave
+//                4. Slices are freed individually by PatchArena_Free() and the block is recycled once all of its
+//                   slices handed out have been freed and it is no longer open
+//                   --> Slices may thus be moved between patches (e.g., LB_Refine_AllocateNewPatch())
+//                5. Thread-safe
+//
+// Parameter   :  Size    : Number of bytes to be allocated
+//                LocalID : Local index of the patch in its patch group (0 ~ 7)
+//                Sg      : Sandglass of the patch
+//
+// Return      :  Pointer to the allocated memory
+//-------------------------------------------------------------------------------------------------------
+void *PatchArena_AllocGroup( const size_t Size, const int LocalID, const int Sg )
+{
+
+   if ( ! OPT__PATCH_ARENA )  return malloc( Size );
+
+#  ifdef GAMER_DEBUG
+   if ( LocalID < 0  ||  LocalID >= Arena_GroupSize )
+      Aux_Error( ERROR_INFO, "incorrect LocalID (%d) !!\n", LocalID );
+
+   if ( Sg != 0  &&  Sg != 1 )
+      Aux_Error( ERROR_INFO, "incorrect Sg (%d) !!\n", Sg );
+#  endif
+
+
+#  ifdef OPENMP
+   Arena_t      *A     = LockArena( omp_get_thread_num() % Arena_NThread );
+#  else
+   Arena_t      *A     = LockArena( 0 );
+#  endif
+   ArenaClass_t *Class = A->Class + GetClass( A, Size, true );
+   ArenaOpen_t  *Open  = Class->Open + Sg;
+
+// open a new block for a new patch group
+   if ( Open->Slab == NULL  ||  LocalID < Open->Next )
+   {
+      CloseBlock( Class, Sg );
+
+      Open->Slab = TakeChunk( A, Class, Open->Chunk );
+      Open->Slab->NLive[ Open->Chunk ] = 0;
+   }
+
+   void *Ptr = Open->Slab->Base + Open->Chunk*Class->Stride + LocalID*Class->Slice;
+
+   Open->Slab->NLive[ Open->Chunk ] ++;
+   Open->Next = LocalID + 1;
+
+// all slices have been handed out
+   if ( Open->Next == Arena_GroupSize )   Open->Slab = NULL;
+
+   UnlockArena( A );
+
+   return Ptr;
+
+} // FUNCTION : PatchArena_AllocGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchArena_Free
+// Description :  Return the memory allocated by PatchArena_Alloc() or PatchArena_AllocGroup()
+//
+// Note        :  1. Use free() directly if OPT__PATCH_ARENA is off
+//                2. Do nothing if Ptr == NULL
+//                3. The chunk is returned to the arena of the thread that allocated it
+//                4. Slabs are not released here (see PatchArena_Shrink())
+//                5. Thread-safe
+//
+// Parameter   :  Ptr : Pointer returned by PatchArena_Alloc() or PatchArena_AllocGroup()
+//-------------------------------------------------------------------------------------------------------
+void PatchArena_Free( void *Ptr )
+{
+
+   if ( Ptr == NULL )   return;
+
+   if ( ! OPT__PATCH_ARENA )
+   {
+      free( Ptr );
+      return;
+   }
+
+
+   ArenaSlab_t  *Slab   = FindSlab( Ptr );
+   Arena_t      *A      = LockArena( Slab->Owner );
+   ArenaClass_t *Class  = A->Class + Slab->Class;
+   const size_t  Offset = (char*)Ptr - Slab->Base;
+   const int     Chunk  = Offset / Class->Stride;
+
+#  ifdef GAMER_DEBUG
+   if ( Chunk >= Slab->NChunk  ||  Offset % Class->Slice != 0  ||  ( !Class->Group && Offset % Class->Stride != 0 )  ||
+        ( Class->Group && Slab->NLive[Chunk] == 0 )  ||  Slab->NFree >= Slab->NChunk )
+      Aux_Error( ERROR_INFO, "invalid pointer %p freed to the patch arena !!\n", Ptr );
+#  endif
+
+   if ( Class->Group )
+   {
+//    keep the block until all of its slices have been freed and it is no longer open
+      if ( --Slab->NLive[Chunk] == 0 )
+      {
+         bool IsOpen = false;
+
+         for (int Sg=0; Sg<2; Sg++)
+            if ( Class->Open[Sg].Slab == Slab  &&  Class->Open[Sg].Chunk == Chunk )   IsOpen = true;
+
+         if ( !IsOpen )    ReleaseChunk( Class, Slab, Chunk );
+      }
+   }
+
+   else
+      ReleaseChunk( Class, Slab, Chunk );
+
+   UnlockArena( A );
+
+} // FUNCTION : PatchArena_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchArena_Shrink
+// Description :  Release the empty slabs of the patch arena back to the system
+//
+// Note        :  1. Invoked after regridding (e.g., EvolveLevel())
+//                   --> Must not be called while a patch group is being allocated since it closes all open
+//                       blocks of the group classes
+//                2. Keep one empty slab in each size class to avoid repeatedly mapping and unmapping memory
+//                   when the number of patches oscillates
+//                3. Do nothing if OPT__PATCH_ARENA is off
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void PatchArena_Shrink()
+{
+
+   if ( ! OPT__PATCH_ARENA )  return;
+
+
+   for (int t=0; t<Arena_NThread; t++)
+   {
+      Arena_t *A = LockArena( t );
+
+      for (int c=0; c<A->NClass; c++)
+      {
+         ArenaClass_t *Class   = A->Class + c;
+         bool          KeepOne = true;
+         int           NSlab   = 0;
+
+         if ( Class->Group )
+         for (int Sg=0; Sg<2; Sg++)    CloseBlock( Class, Sg );
+
+//       release the empty slabs (except one) and compact the slab list
+         for (int s=0; s<Class->NSlab; s++)
+         {
+            ArenaSlab_t *Slab = Class->Slab[s];
+
+            if ( Slab->NFree == Slab->NChunk  &&  !KeepOne )
+               DeleteSlab( Slab );
+
+            else
+            {
+               if ( Slab->NFree == Slab->NChunk )  KeepOne = false;
+
+               Slab->Index             = NSlab;
+               Class->Slab[ NSlab ++ ] = Slab;
+            }
+         }
+
+         Class->NSlab      = NSlab;
+         Class->FirstAvail = 0;
+      }
+
+      UnlockArena( A );
+   }
+
+} // FUNCTION : PatchArena_Shrink
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchArena_End
+// Description :  Release all slabs of the patch arena
+//
+// Note        :  1. Invoked by End_MemFree() after all patches have been deleted
+//                2. Do nothing if OPT__PATCH_ARENA is off
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void PatchArena_End()
+{
+
+   if ( ! OPT__PATCH_ARENA )  return;
+
+   for (int t=0; t<Arena_NThread; t++)
+   {
+      Arena_t *A = Arena + t;
+
+      for (int c=0; c<A->NClass; c++)
+      {
+         ArenaClass_t *Class = A->Class + c;
+
+         if ( Class->Group )
+         for (int Sg=0; Sg<2; Sg++)    CloseBlock( Class, Sg );
+
+         if ( Class->NUsed != 0 )
+            Aux_Message( stderr, "WARNING : %ld chunk(s) of %zu bytes are still in use in the patch arena !!\n",
+                         Class->NUsed, Class->Stride );
+
+         for (int s=0; s<Class->NSlab; s++)  DeleteSlab( Class->Slab[s] );
+
+         free( Class->Slab );
+      }
+
+#     ifdef OPENMP
+      omp_destroy_lock( &A->Lock );
+#     endif
+   }
+
+   delete [] Arena;
+
+   Arena         = NULL;
+   Arena_NThread = 0;
+
+   for (long t=0; t<(1L<<(Arena_AddrBit-Arena_PageBit-Arena_LeafBit)); t++)
+   {
+      delete [] Arena_Map[t];
+      Arena_Map[t] = NULL;
+   }
+
+} // FUNCTION : PatchArena_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetClass
+// Description :  Return the size class of the target chunk size and create it if it does not exist
+//
+// Note        :  There are only a few size classes (fluid, magnetic, pot, flux, ...), so a linear search suffices
+//
+// Parameter   :  A     : Target thread arena
+//                Size  : Chunk (or slice) size in bytes
+//                Group : true --> group class used by PatchArena_AllocGroup()
+//
+// Return      :  Index of the size class
+//-------------------------------------------------------------------------------------------------------
+int GetClass( Arena_t *A, const size_t Size, const bool Group )
+{
+
+   for (int c=0; c<A->NClass; c++)
+      if ( A->Class[c].Size == Size  &&  A->Class[c].Group == Group )   return c;
+
+   if ( A->NClass >= Arena_NClassMax )
+      Aux_Error( ERROR_INFO, "number of size classes in the patch arena exceeds the limit (%d) !!\n", Arena_NClassMax );
+
+   ArenaClass_t *Class = A->Class + A->NClass;
+
+   Class->Size       = Size;
+   Class->Group      = Group;
+   Class->Slice      = ( Size + Arena_Align - 1 ) / Arena_Align * Arena_Align;
+   Class->Stride     = ( Group ) ? Arena_GroupSize*Class->Slice : Class->Slice;
+   Class->NSlab      = 0;
+   Class->NSlabAlloc = 0;
+   Class->Slab       = NULL;
+   Class->FirstAvail = 0;
+   Class->NUsed      = 0;
+
+   for (int Sg=0; Sg<2; Sg++)    Class->Open[Sg].Slab = NULL;
+
+   return A->NClass ++;
+
+} // FUNCTION : GetClass
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  TakeChunk
+// Description :  Take a free chunk from the oldest slab with free chunks and map a new slab if necessary
+//
+// Parameter   :  A     : Thread arena owning the target size class
+//                Class : Target size class
+//                Chunk : Index of the chunk in the returned slab
+//
+// Return      :  Slab of the chunk and Chunk
+//-------------------------------------------------------------------------------------------------------
+ArenaSlab_t *TakeChunk( Arena_t *A, ArenaClass_t *Class, int &Chunk )
+{
+
+   ArenaSlab_t *Slab = NULL;
+
+// find the first slab with free chunks
+   while ( Class->FirstAvail < Class->NSlab )
+   {
+      if ( Class->Slab[ Class->FirstAvail ]->NFree > 0 )
+      {
+         Slab = Class->Slab[ Class->FirstAvail ];
+         break;
+      }
+
+      Class->FirstAvail ++;
+   }
+
+   if ( Slab == NULL )  Slab = NewSlab( A, Class - A->Class );
+
+   Chunk = Slab->FreeList[ --Slab->NFree ];
+
+   Class->NUsed ++;
+
+   return Slab;
+
+} // FUNCTION : TakeChunk
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReleaseChunk
+// Description :  Push a chunk back to the free list of its slab
+//
+// Parameter   :  Class : Size class of the slab
+//                Slab  : Slab of the chunk
+//                Chunk : Index of the chunk in the slab
+//-------------------------------------------------------------------------------------------------------
+void ReleaseChunk( ArenaClass_t *Class, ArenaSlab_t *Slab, const int Chunk )
+{
+
+   Slab->FreeList[ Slab->NFree ++ ] = Chunk;
+
+   Class->FirstAvail = MIN( Class->FirstAvail, Slab->Index );
+   Class->NUsed --;
+
+} // FUNCTION : ReleaseChunk
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CloseBlock
+// Description :  Stop handing out slices from the open block of a group class
+//
+// Note        :  Release the block if none of its slices is in use
+//
+// Parameter   :  Class : Target group class
+//                Sg    : Sandglass of the open block
+//-------------------------------------------------------------------------------------------------------
+void CloseBlock( ArenaClass_t *Class, const int Sg )
+{
+
+   ArenaOpen_t *Open = Class->Open + Sg;
+
+   if ( Open->Slab == NULL )  return;
+
+   if ( Open->Slab->NLive[ Open->Chunk ] == 0 )    ReleaseChunk( Class, Open->Slab, Open->Chunk );
+
+   Open->Slab = NULL;
+
+} // FUNCTION : CloseBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  NewSlab
+// Description :  Map a new slab for the target size class
+//
+// Note        :  1. The slab is aligned to and padded to a multiple of Arena_SlabAlign bytes
+//                2. The number of chunks is max( Arena_MinChunk patches, NUsed/8 ) rounded up to fill the
+//                   padded slab
+//
+// Parameter   :  A : Thread arena owning the target size class
+//                c : Target size class
+//
+// Return      :  Pointer to the new slab
+//-------------------------------------------------------------------------------------------------------
+ArenaSlab_t *NewSlab( Arena_t *A, const int c )
+{
+
+   ArenaClass_t *Class = A->Class + c;
+
+   const long   NChunk_Min = MAX( (long)( Arena_MinChunk*Class->Slice/Class->Stride ), Class->NUsed/8 );
+   const size_t NByte      = ( NChunk_Min*Class->Stride + Arena_SlabAlign - 1 ) / Arena_SlabAlign * Arena_SlabAlign;
+
+// over-allocate by Arena_SlabAlign and unmap the unaligned head and tail
+   char *Map = (char*)mmap( NULL, NByte+Arena_SlabAlign, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+   if ( Map == MAP_FAILED )
+      Aux_Error( ERROR_INFO, "mmap() failed when allocating %zu bytes for the patch arena !!\n", NByte );
+
+   char        *Base = (char*)(  ( (size_t)Map + Arena_SlabAlign - 1 ) / Arena_SlabAlign * Arena_SlabAlign  );
+   const size_t Head = Base - Map;
+   const size_t Tail = Arena_SlabAlign - Head;
+
+   if ( Head > 0 )   munmap( Map, Head );
+   if ( Tail > 0 )   munmap( Base+NByte, Tail );
+
+#  ifdef MADV_HUGEPAGE
+   madvise( Base, NByte, MADV_HUGEPAGE );
+#  endif
+
+
+   ArenaSlab_t *Slab = new ArenaSlab_t;
+
+   Slab->Base     = Base;
+   Slab->NByte    = NByte;
+   Slab->NChunk   = NByte / Class->Stride;
+   Slab->NFree    = Slab->NChunk;
+   Slab->FreeList = new int [Slab->NChunk];
+   Slab->NLive    = ( Class->Group ) ? new unsigned char [Slab->NChunk] : NULL;
+   Slab->Owner    = A - Arena;
+   Slab->Class    = c;
+   Slab->Index    = Class->NSlab;
+
+// pop chunks in ascending address order
+   for (int t=0; t<Slab->NChunk; t++)  Slab->FreeList[t] = Slab->NChunk - 1 - t;
+
+   MapSlab( Slab, Slab );
+
+
+// append it to the slab list
+   if ( Class->NSlab == Class->NSlabAlloc )
+   {
+      Class->NSlabAlloc = MAX( 2*Class->NSlabAlloc, 16 );
+      Class->Slab       = (ArenaSlab_t**)realloc( Class->Slab, Class->NSlabAlloc*sizeof(ArenaSlab_t*) );
+   }
+
+   Class->Slab[ Class->NSlab ++ ] = Slab;
+
+   return Slab;
+
+} // FUNCTION : NewSlab
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  DeleteSlab
+// Description :  Unmap the target slab and free its bookkeeping arrays
+//
+// Parameter   :  Slab : Target slab
+//-------------------------------------------------------------------------------------------------------
+void DeleteSlab( ArenaSlab_t *Slab )
+{
+
+   MapSlab( Slab, NULL );
+
+   munmap( Slab->Base, Slab->NByte );
+
+   delete [] Slab->FreeList;
+   delete [] Slab->NLive;
+   delete Slab;
+
+} // FUNCTION : DeleteSlab
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  MapSlab
+// Description :  Set the page-map entries of all 2 MB pages of a slab
+//
+// Note        :  1. The page map is a two-level table indexed by the page number (i.e., address >> Arena_PageBit)
+//                   --> Leaves are allocated on demand and never released
+//                2. Entries of different slabs never overlap, and a chunk is only freed after its slab has
+//                   been mapped, so FindSlab() does not need to lock
+//
+// Parameter   :  Slab   : Target slab
+//                Target : Value to be stored (Slab or NULL)
+//-------------------------------------------------------------------------------------------------------
+void MapSlab( ArenaSlab_t *Slab, ArenaSlab_t *Target )
+{
+
+   const size_t Page0 = (size_t)Slab->Base >> Arena_PageBit;
+   const size_t NPage = Slab->NByte >> Arena_PageBit;
+
+   if (  ( (size_t)Slab->Base + Slab->NByte - 1 ) >> Arena_AddrBit  )
+      Aux_Error( ERROR_INFO, "address %p exceeds %d bits !!\n", Slab->Base, Arena_AddrBit );
+
+#  pragma omp critical( PATCH_ARENA_MAP )
+   for (size_t p=Page0; p<Page0+NPage; p++)
+   {
+      ArenaSlab_t **&Leaf = Arena_Map[ p >> Arena_LeafBit ];
+
+      if ( Leaf == NULL )
+      {
+         Leaf = new ArenaSlab_t* [ 1L << Arena_LeafBit ];
+         for (long t=0; t<(1L<<Arena_LeafBit); t++)  Leaf[t] = NULL;
+      }
+
+      Leaf[ p & ((1L<<Arena_LeafBit)-1) ] = Target;
+   }
+
+} // FUNCTION : MapSlab
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FindSlab
+// Description :  Return the slab storing the target address
+//
+// Parameter   :  Ptr : Target address
+//
+// Return      :  Pointer to the slab
+//-------------------------------------------------------------------------------------------------------
+ArenaSlab_t *FindSlab( const void *Ptr )
+{
+
+   const size_t  Page = (size_t)Ptr >> Arena_PageBit;
+   ArenaSlab_t **Leaf = Arena_Map[ Page >> Arena_LeafBit ];
+   ArenaSlab_t  *Slab = ( Leaf == NULL ) ? NULL : Leaf[ Page & ((1L<<Arena_LeafBit)-1) ];
+
+   if ( Slab == NULL )
+      Aux_Error( ERROR_INFO, "pointer %p does not belong to the patch arena !!\n", Ptr );
+
+   return Slab;
+
+} // FUNCTION : FindSlab
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LockArena / UnlockArena
+// Description :  Lock/unlock a thread arena
+//
+// Parameter   :  Owner : Index of the target thread arena
+//                A     : Target thread arena
+//
+// Return      :  LockArena() returns the target thread arena
+//-------------------------------------------------------------------------------------------------------
+Arena_t *LockArena( const int Owner )
+{
+
+   Arena_t *A = Arena + Owner;
+
+#  ifdef OPENMP
+   omp_set_lock( &A->Lock );
+#  endif
+
+   return A;
+
+} // FUNCTION : LockArena
+
+void UnlockArena( Arena_t *A )
+{
+
+#  ifdef OPENMP
+   omp_unset_lock( &A->Lock );
+#  else
+   (void)A;    // unused when OpenMP is off
+#  endif
+
+} // FUNCTION : UnlockArena
@@ -2,6 +2,22 @@
 
 double dt_min_for_solver;
 
+static bool dt_IsPrefetched( const Solver_t TSolver, const int lv );
+
+// local minimum dt evaluated in advance by dt_Prefetch() for OPT__CONCURRENT_DT
+// --> tagged with the sandglasses and physical time it depends on so that it is used only if
+//     the target level has not been updated since then
+struct dtPrefetch_t
+{
+   bool   Valid;
+   int    FluSg;
+   int    MagSg;
+   double Time;
+   double dt_min;
+};
+
+static dtPrefetch_t dtPrefetch_Flu[NLEVEL];
+
 
 
 
@@ -11,6 +27,7 @@ double dt_min_for_solver;
 //
 // Note        :  1. Invoked by Mis_GetTimeStep()
 //                2. The global variable "dt_min_for_solver" will be set by dt_Close()
+//                3. Reuse the local minimum dt evaluated by dt_Prefetch() if it is still valid
 //
 // Parameter   :  TSolver : Target dt solver
 //                          --> DT_FLU_SOLVER, DT_GRA_SOLVER
@@ -21,12 +38,20 @@ double dt_min_for_solver;
 double dt_InvokeSolver( const Solver_t TSolver, const int lv )
 {
 
-// initialize it as an extremely large value, which will be reset by dt_Close()
-   dt_min_for_solver = HUGE_NUMBER;
+// use the prefetched dt if available
+   if ( dt_IsPrefetched( TSolver, lv ) )
+      dt_min_for_solver = dtPrefetch_Flu[lv].dt_min;
 
+   else
+   {
+//    initialize it as an extremely large value, which will be reset by dt_Close()
+      dt_min_for_solver = HUGE_NUMBER;
 
-// invoke the target dt solver
-   InvokeSolver( TSolver, lv, Time[lv], NULL_REAL, NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT, false, false );
+//    invoke the target dt solver
+      InvokeSolver( TSolver, lv, Time[lv], NULL_REAL, NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT, false, false );
+   }
+
+   if ( TSolver == DT_FLU_SOLVER )  dtPrefetch_Flu[lv].Valid = false;
 
 
 // get the minimum dt among all ranks
@@ -37,3 +62,82 @@ double dt_InvokeSolver( const Solver_t TSolver, const int lv )
    return dt_min_all_rank;
 
 } // FUNCTION : dt_InvokeSolver
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_Prefetch
+// Description :  Evaluate the local minimum time-step in advance so that it can run concurrently with
+//                the solvers on other levels
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() for OPT__CONCURRENT_DT
+//                2. Only the local minimum on this rank is computed
+//                   --> No MPI communication, which is done later by dt_InvokeSolver()
+//                3. The result is consumed by the next dt_InvokeSolver() on the same level as long as
+//                   FluSg[lv], MagSg[lv], and Time[lv] remain the same
+//                4. Only support DT_FLU_SOLVER, which reads the fluid data on the target level without ghost zones
+//                   and thus does not depend on other levels
+//
+// Parameter   :  TSolver : Target dt solver
+//                          --> DT_FLU_SOLVER only
+//                lv      : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void dt_Prefetch( const Solver_t TSolver, const int lv )
+{
+
+   if ( TSolver != DT_FLU_SOLVER )
+      Aux_Error( ERROR_INFO, "unsupported solver %d for dt_Prefetch() !!\n", TSolver );
+
+
+// nothing to do if it has been evaluated (e.g., when the fluid solver on lv-1 is retried by AUTO_REDUCE_DT)
+   if ( dt_IsPrefetched( TSolver, lv ) )  return;
+
+
+// invoke the target dt solver
+   dt_min_for_solver = HUGE_NUMBER;
+
+   InvokeSolver( TSolver, lv, Time[lv], NULL_REAL, NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT, false, false );
+
+
+// record the result together with the data it depends on
+   dtPrefetch_t *Prefetch = &dtPrefetch_Flu[lv];
+
+   Prefetch->FluSg  = amr->FluSg[lv];
+#  ifdef MHD
+   Prefetch->MagSg  = amr->MagSg[lv];
+#  else
+   Prefetch->MagSg  = NULL_INT;
+#  endif
+   Prefetch->Time   = Time[lv];
+   Prefetch->dt_min = dt_min_for_solver;
+   Prefetch->Valid  = true;
+
+} // FUNCTION : dt_Prefetch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_IsPrefetched
+// Description :  Check whether the local minimum time-step of the target solver and level has been evaluated
+//                by dt_Prefetch() and is still valid
+//
+// Parameter   :  TSolver : Target dt solver
+//                lv      : Target refinement level
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool dt_IsPrefetched( const Solver_t TSolver, const int lv )
+{
+
+   if ( TSolver != DT_FLU_SOLVER )  return false;
+
+   const dtPrefetch_t *Prefetch = &dtPrefetch_Flu[lv];
+
+   return (  Prefetch->Valid  &&
+             Prefetch->FluSg == amr->FluSg[lv]  &&
+#            ifdef MHD
+             Prefetch->MagSg == amr->MagSg[lv]  &&
+#            endif
+             Prefetch->Time  == Time[lv]  );
+
+} // FUNCTION : dt_IsPrefetched
@@ -45,7 +45,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real MinDens, const real MinPres, const real MinEint,
                                const bool FracPassive, const int NFrac, const int FracIdx[],
                                const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS );
+                               const EoS_t *EoS, const int k_fc_s, const int k_fc_e );
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
@@ -53,12 +53,13 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                         const real dt, const real dh, const double Time, const bool UsePot,
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
                         const real MinDens, const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
-                        const EoS_t *EoS );
+                        const EoS_t *EoS, const int k_flux_s, const int k_flux_e );
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const EoS_t *EoS, int *s_FullStepFailure, const int Iteration, const int MinMod_MaxIter );
+                           const EoS_t *EoS, int *s_FullStepFailure, const int Iteration, const int MinMod_MaxIter,
+                           const int k_out_s, const int k_out_e );
 #if ( RSOLVER == EXACT  ||  RSOLVER_RESCUE == EXACT )
 void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                 const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
@@ -136,6 +137,12 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
                                   const bool JeansMinPres, const real JeansMinPres_Coeff,
                                   const EoS_t *EoS );
 #endif
+#if ( !defined __CUDACC__  &&  !defined MHD )
+static void Hydro_LocalFallback( const real g_ConVar[][ CUBE(FLU_NXT) ], const real g_Output[][ CUBE(PS2) ],
+                                 real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                 const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                                 const real MinDens, const real MinPres, const EoS_t *EoS );
+#endif
 
 
 
@@ -159,6 +166,17 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                   reducing the original minmod coefficient repeatedly until either the unphysical result is
 //                   solved or the reduced minmod coefficient equals zero. Note that interpolating with a
 //                   vanished minmod coefficient is equivalent to the piecewise constant spatial reconstruction.
+//                7. For the CPU solver in pure hydro, MinMod_LocalFallback replaces the iterations in Note 6 by
+//                   recomputing only the fluxes across the faces of the failed cells
+//                   --> See Hydro_LocalFallback()
+//                8. MHM: the conserved variables are converted to primitive variables only once for each patch group
+//                   since g_PriVar[] is not modified during the iterations in Note 6
+//                   --> For the CPU solver with OPT__FLU_PREP_PRI, the conversion is already done in Flu_Prepare()
+//                       and g_PriVar_In[] is used directly
+//                9. For the CPU solver with FLU_TILE (see CUFLU.h), the data reconstruction, full-step fluxes,
+//                   and full-step update are evaluated for Tile_NZ z-slabs of the output patch group at a time
+//                   --> Each stage only computes the data not yet computed for the previous z-slabs, so the results
+//                       do not depend on Tile_NZ
 //
 //
 // Parameter   :  g_Flu_Array_In     : Array storing the input fluid variables
@@ -171,6 +189,9 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                g_Corner_Array     : Array storing the physical corner coordinates of each patch group (for UNSPLIT_GRAVITY)
 //                g_Pot_Array_USG    : Array storing the input potential for UNSPLIT_GRAVITY
 //                g_PriVar           : Array to store the primitive variables
+//                g_PriVar_In        : Array storing the input primitive variables prepared by Flu_Prepare()
+//                                     (for MHM with OPT__FLU_PREP_PRI and CPU only)
+//                                     --> NULL: convert g_Flu_Array_In[] to primitive variables in g_PriVar[]
 //                g_Slope_PPM        : Array to store the slope for the PPM reconstruction
 //                g_FC_Var           : Array to store the half-step variables
 //                g_FC_Flux          : Array to store the face-centered fluxes
@@ -186,6 +207,10 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                                                    vanLeer + generalized MinMod/extrema-preserving) limiter
 //                MinMod_Coeff       : Coefficient of the generalized MinMod limiter
 //                MinMod_MaxIter     : Maximum number of iterations to reduce MinMod_Coeff
+//                MinMod_LocalFallback: true --> invoke Hydro_LocalFallback() instead of reducing MinMod_Coeff
+//                                     for the entire patch group (for CPU and pure hydro only)
+//                Tile_NZ            : Number of z-slabs advanced at a time (<=0: entire patch group)
+//                                     --> See Note 9 (for CPU and FLU_TILE only)
 //                Time               : Current physical time                                 (for UNSPLIT_GRAVITY only)
 //                UsePot             : Add self-gravity and/or external potential            (for UNSPLIT_GRAVITY only)
 //                ExtAcc             : Add external acceleration                             (for UNSPLIT_GRAVITY only)
@@ -258,6 +283,7 @@ void CPU_FluidSolver_MHM(
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
          real   g_PriVar       []   [NCOMP_LR            ][ CUBE(FLU_NXT) ],
+         real   g_PriVar_In    []   [NCOMP_TOTAL         ][ CUBE(FLU_NXT) ],
          real   g_Slope_PPM    [][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
          real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
          real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
@@ -266,7 +292,8 @@ void CPU_FluidSolver_MHM(
    const int NPatchGroup,
    const real dt, const real dh,
    const bool StoreFlux, const bool StoreElectric,
-   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const int MinMod_MaxIter, const double Time,
+   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const int MinMod_MaxIter,
+   const bool MinMod_LocalFallback, const int Tile_NZ, const double Time,
    const bool UsePot, const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func,
    const double c_ExtAcc_AuxArray[],
    const real MinDens, const real MinPres, const real MinEint,
@@ -284,17 +311,32 @@ void CPU_FluidSolver_MHM(
    const bool CorrHalfVel          = false;
 #  endif
 #  if   ( FLU_SCHEME == MHM )
-   const bool Con2Pri_Yes          = true;
+#  ifdef FLU_PREP_PRI
+   const bool Con2Pri_MHM          = ( g_PriVar_In == NULL );
+#  else
+   const bool Con2Pri_MHM          = true;
+#  endif
 #  elif ( FLU_SCHEME == MHM_RP )
    const bool Con2Pri_No           = false;
 #  endif
+#  if ( !defined __CUDACC__  &&  !defined FLU_PREP_PRI )
+   (void)g_PriVar_In;   // only used by OPT__FLU_PREP_PRI
+#  endif
 #  ifdef MHD
-   const bool CorrHalfVel_No       = false;
+   const bool CorrHalfVel_No      = false;
    const bool StoreElectric_No     = false;
 #  endif
 #  if ( defined __CUDACC__  &&  !defined GRAVITY )
    const double *c_ExtAcc_AuxArray = NULL;
 #  endif
+#  ifdef __CUDACC__
+   const bool MinMod_LocalFallback = false;
+#  endif
+#  ifdef FLU_TILE
+   const int  NTile                = ( Tile_NZ > 0 ) ? MIN( Tile_NZ, PS2 ) : PS2;
+#  else
+   const int  NTile                = PS2;
+#  endif
 
    int Iteration;
 #  ifdef __CUDACC__
@@ -411,34 +453,18 @@ void CPU_FluidSolver_MHM(
                                JeansMinPres, JeansMinPres_Coeff, &EoS );
 
 
-         do {
-
-#           ifdef __CUDACC__
-            __syncthreads();
-#           endif
-            s_FullStepFailure = 0;
-#           ifdef __CUDACC__
-            __syncthreads();
-#           endif
-
-            real AdaptiveMinModCoeff = ( MinMod_MaxIter == 0 ) ? MinMod_Coeff :
-            MinMod_Coeff - (real)Iteration * MinMod_Coeff / (real)MinMod_MaxIter;
-
-
-//          ensure adaptive MinMod_Coeff is non-negative
-            AdaptiveMinModCoeff = FMAX( AdaptiveMinModCoeff, (real)0.0 );
-
+//       1-b. MHM: use interpolated face-centered values to calculate the half-step fluxes
+//            --> primitive variables are either prepared by Flu_Prepare() or converted from g_Flu_Array_In[] to g_PriVar_1PG[]
+#        elif ( FLU_SCHEME == MHM )
 
-//          1-a-5. evaluate the face-centered values by data reconstruction
-//                 --> note that g_PriVar_Half_1PG[] returned by Hydro_RiemannPredict() stores the primitive variables
-            Hydro_DataReconstruction( NULL, g_FC_Mag_Half_1PG, g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                      Con2Pri_No, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
-                                      MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
-                                      JeansMinPres, JeansMinPres_Coeff, &EoS );
+#        ifdef FLU_PREP_PRI
+         real (*const g_PriVar_MHM_1PG)[ CUBE(FLU_NXT) ] = ( Con2Pri_MHM ) ? g_PriVar_1PG : g_PriVar_In[P];
+#        else
+         real (*const g_PriVar_MHM_1PG)[ CUBE(FLU_NXT) ] = g_PriVar_1PG;
+#        endif
 
+#        endif // #if ( FLU_SCHEME == MHM_RP ) ... elif ...
 
-//       1-b. MHM: use interpolated face-centered values to calculate the half-step fluxes
-#        elif ( FLU_SCHEME == MHM )
 
          do {
 
@@ -458,48 +484,92 @@ void CPU_FluidSolver_MHM(
             AdaptiveMinModCoeff = FMAX( AdaptiveMinModCoeff, (real)0.0 );
 
 
-//          evaluate the face-centered values by data reconstruction
-            Hydro_DataReconstruction( g_Flu_Array_In[P], NULL, g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                      Con2Pri_Yes, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
-                                      MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
-                                      JeansMinPres, JeansMinPres_Coeff, &EoS );
+//          loop over the z-slabs of the output patch group (see Note 9)
+//          --> NTile == PS2 (i.e., a single tile covering all data) except for the CPU solver with FLU_TILE
+            for (int k_out_s=0; k_out_s<PS2; k_out_s+=NTile)
+            {
+               const bool LastTile = ( k_out_s + NTile >= PS2 );
+               const int  k_out_e  = ( LastTile ) ? PS2 : k_out_s + NTile;
+
+//             output z-slab k requires the z fluxes k and k+1 and the x/y fluxes k, which in turn require the
+//             face-centered variables k, k+1, and k+1 (i.e., NSkip_T=1), respectively
+//             --> the last tile covers all remaining data, including the extra data required by MHD
+               const int  k_fc_s   = ( k_out_s == 0 ) ? 0 : k_out_s + 2;
+               const int  k_fc_e   = ( LastTile ) ? N_FC_VAR : k_out_e + 2;
+               const int  k_flux_s = ( k_out_s == 0 ) ? 0 : k_out_s + 1;
+               const int  k_flux_e = ( LastTile ) ? N_FC_VAR : k_out_e + 1;
+
+
+//             1-a-5. MHM_RP: evaluate the face-centered values by data reconstruction
+//                    --> note that g_PriVar_Half_1PG[] returned by Hydro_RiemannPredict() stores the primitive variables
+#              if   ( FLU_SCHEME == MHM_RP )
+               Hydro_DataReconstruction( NULL, g_FC_Mag_Half_1PG, g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                         Con2Pri_No, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
+                                         MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
+                                         JeansMinPres, JeansMinPres_Coeff, &EoS, k_fc_s, k_fc_e );
+
+//             1-b. MHM: evaluate the face-centered values by data reconstruction
+//                  --> g_PriVar_1PG[] is not modified after the first iteration so it's unnecessary to redo Con2Pri
+#              elif ( FLU_SCHEME == MHM )
+               Hydro_DataReconstruction( g_Flu_Array_In[P], NULL, g_PriVar_MHM_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                         Con2Pri_MHM && Iteration == 0, LR_Limiter, AdaptiveMinModCoeff, dt, dh,
+                                         MinDens, MinPres, MinEint, FracPassive, NFrac, c_FracIdx,
+                                         JeansMinPres, JeansMinPres_Coeff, &EoS, k_fc_s, k_fc_e );
+#              endif
+
+
+//             2. evaluate the full-step fluxes
+#              ifdef MHD
+               const int NSkip_N = 0;
+               const int NSkip_T = 0;
+#              else
+               const int NSkip_N = 0;
+               const int NSkip_T = 1;
+#              endif
 
-#        endif // #if ( FLU_SCHEME == MHM_RP ) ... else ...
+               Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T,
+                                  CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                  dt, dh, Time, UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
+                                  MinDens, MinPres, StoreFlux, g_Flux_Array[P], &EoS, k_flux_s, k_flux_e );
 
 
-//          2. evaluate the full-step fluxes
-#           ifdef MHD
-            const int NSkip_N = 0;
-            const int NSkip_T = 0;
-#           else
-            const int NSkip_N = 0;
-            const int NSkip_T = 1;
-#           endif
+//             3. evaluate electric field and update B field at the full time-step
+//                --> must update B field before Hydro_FullStepUpdate() since the latter requires
+//                    the updated magnetic energy when adopting the dual-energy formalism
+#              ifdef MHD
+               MHD_ComputeElectric( g_EC_Ele_1PG, g_FC_Flux_1PG, g_PriVar_Half_1PG, N_FL_ELE, N_FL_FLUX,
+                                    N_HF_VAR, LR_GHOST_SIZE, dt, dh, StoreElectric, g_Ele_Array[P],
+                                    CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P], Time,
+                                    UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray );
 
-            Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T,
-                               CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
-                               dt, dh, Time, UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
-                               MinDens, MinPres, StoreFlux, g_Flux_Array[P], &EoS );
+               MHD_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
+                                   g_Mag_Array_In[P], g_EC_Ele_1PG, dt, dh, PS2, N_FL_ELE, FLU_GHOST_SIZE );
+#              endif
 
 
-//          3. evaluate electric field and update B field at the full time-step
-//             --> must update B field before Hydro_FullStepUpdate() since the latter requires
-//                 the updated magnetic energy when adopting the dual-energy formalism
-#           ifdef MHD
-            MHD_ComputeElectric( g_EC_Ele_1PG, g_FC_Flux_1PG, g_PriVar_Half_1PG, N_FL_ELE, N_FL_FLUX,
-                                 N_HF_VAR, LR_GHOST_SIZE, dt, dh, StoreElectric, g_Ele_Array[P],
-                                 CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P], Time,
-                                 UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray );
+//             4. full-step evolution
+               Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
+                                     g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
+                                     NormPassive, NNorm, c_NormIdx, &EoS, &s_FullStepFailure, Iteration, MinMod_MaxIter,
+                                     k_out_s, k_out_e );
+            } // for (int k_out_s=0; k_out_s<PS2; k_out_s+=NTile)
 
-            MHD_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
-                                g_Mag_Array_In[P], g_EC_Ele_1PG, dt, dh, PS2, N_FL_ELE, FLU_GHOST_SIZE );
-#           endif
 
+//          4-1. recompute the fluxes around the failed cells only and redo the full-step update
+//               --> Hydro_FullStepUpdate() is cheap compared to the data reconstruction and Riemann solver,
+//                   and it returns the same results for cells whose fluxes are not changed
+//               --> any remaining unphysical cell will be corrected by Flu_Close()
+#           if ( !defined __CUDACC__  &&  !defined MHD )
+            if ( s_FullStepFailure  &&  MinMod_LocalFallback )
+            {
+               Hydro_LocalFallback( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_FC_Flux_1PG, StoreFlux, g_Flux_Array[P],
+                                    MinDens, MinPres, &EoS );
 
-//          4. full-step evolution
-            Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
-                                  g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
-                                  NormPassive, NNorm, c_NormIdx, &EoS, &s_FullStepFailure, Iteration, MinMod_MaxIter );
+               Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
+                                     g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
+                                     NormPassive, NNorm, c_NormIdx, &EoS, NULL, NULL_INT, NULL_INT, 0, PS2 );
+            }
+#           endif
 
 
 //          5. counter increment
@@ -507,7 +577,7 @@ void CPU_FluidSolver_MHM(
 
 
 
-         } while ( s_FullStepFailure  &&  Iteration <= MinMod_MaxIter );
+         } while ( s_FullStepFailure  &&  !MinMod_LocalFallback  &&  Iteration <= MinMod_MaxIter );
 
       } // loop over all patch groups
    } // OpenMP parallel region
@@ -854,4 +924,140 @@ void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 
 
 
+#if ( !defined __CUDACC__  &&  !defined MHD )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_LocalFallback
+// Description :  Replace the fluxes across the faces of the unphysical cells returned by Hydro_FullStepUpdate()
+//                with the first-order fluxes
+//
+// Note        :  1. Invoked by CPU_FluidSolver_MHM() when MinMod_LocalFallback is on
+//                   --> Alternative to reducing the minmod coefficient for the entire patch group
+//                2. Unphysical cells are identified by the same criteria adopted by Hydro_FullStepUpdate()
+//                3. First-order fluxes are computed by the Riemann solver RSOLVER with the left/right states
+//                   set to the input conserved variables (i.e., piecewise constant reconstruction)
+//                   --> They do NOT include the half-step gravity correction for UNSPLIT_GRAVITY
+//                4. Each face flux is updated only once and is shared by the two adjacent cells, so the
+//                   full-step update remains conservative
+//                   --> Fluxes across the outer faces of the patch group are left untouched since they are also
+//                       computed independently by the neighboring patch groups
+//                   --> The inter-patch fluxes in g_IntFlux[] are updated accordingly
+//                5. Caller must invoke Hydro_FullStepUpdate() again afterwards
+//                6. Only support pure hydro since the MHD electric field is computed from the fluxes
+//
+// Parameter   :  g_ConVar     : Array storing the input conserved variables
+//                g_Output     : Array storing the output fluid data returned by Hydro_FullStepUpdate()
+//                g_FC_Flux    : Array storing the face-centered fluxes
+//                               --> Accessed with the array stride N_FL_FLUX
+//                DumpIntFlux  : true --> update the inter-patch fluxes in g_IntFlux[]
+//                g_IntFlux    : Array for DumpIntFlux
+//                MinDens/Pres : Density and pressure floors
+//                EoS          : EoS object
+//-------------------------------------------------------------------------------------------------------
+void Hydro_LocalFallback( const real g_ConVar[][ CUBE(FLU_NXT) ], const real g_Output[][ CUBE(PS2) ],
+                          real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                          const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                          const real MinDens, const real MinPres, const EoS_t *EoS )
+{
+
+   const int  didx_in  [3]    = { 1, FLU_NXT, SQR(FLU_NXT) };
+   const int  didx_flux[3]    = { 1, N_FL_FLUX, SQR(N_FL_FLUX) };
+   const bool CheckMinPres_No = false;
+
+   bool FaceMask[3][ CUBE(N_FL_FLUX) ];
+   real ConVar_L[NCOMP_TOTAL_PLUS_MAG], ConVar_R[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
+   real Output_1Cell[NCOMP_TOTAL];
+
+
+// 1. mark the inner faces of all unphysical cells
+   for (int d=0; d<3; d++)
+   for (int t=0; t<CUBE(N_FL_FLUX); t++)  FaceMask[d][t] = false;
+
+   for (int k_out=0; k_out<PS2; k_out++)
+   for (int j_out=0; j_out<PS2; j_out++)
+   for (int i_out=0; i_out<PS2; i_out++)
+   {
+      const int idx_out    = IDX321( i_out, j_out, k_out, PS2, PS2 );
+      const int idx_flux   = IDX321( i_out, j_out, k_out, N_FL_FLUX, N_FL_FLUX );
+      const int ijk_out[3] = { i_out, j_out, k_out };
+
+      for (int v=0; v<NCOMP_TOTAL; v++)   Output_1Cell[v] = g_Output[v][idx_out];
+
+      const real Pres = Hydro_Con2Pres( Output_1Cell[DENS], Output_1Cell[MOMX], Output_1Cell[MOMY], Output_1Cell[MOMZ],
+                                        Output_1Cell[ENGY], Output_1Cell+NCOMP_FLUID, CheckMinPres_No, NULL_REAL, NULL_REAL,
+                                        EoS->DensEint2Pres_FuncPtr, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int,
+                                        EoS->Table, NULL );
+
+      if (  ! Hydro_CheckUnphysical( UNPHY_MODE_CONS, Output_1Cell, NULL, ERROR_INFO, UNPHY_SILENCE )  &&
+            Pres >= (real)0.0  &&  Pres < HUGE_NUMBER  &&  Pres == Pres  )
+         continue;
+
+      for (int d=0; d<3; d++)
+      {
+         if ( ijk_out[d] > 0     )  FaceMask[d][ idx_flux                ] = true;
+         if ( ijk_out[d] < PS2-1 )  FaceMask[d][ idx_flux + didx_flux[d] ] = true;
+      }
+   } // i,j,k
+
+
+// 2. replace the marked fluxes with the first-order fluxes
+   for (int d=0; d<3; d++)
+   for (int k_flux=0; k_flux<PS2; k_flux++)
+   for (int j_flux=0; j_flux<PS2; j_flux++)
+   for (int i_flux=0; i_flux<PS2; i_flux++)
+   {
+      const int idx_flux = IDX321( i_flux, j_flux, k_flux, N_FL_FLUX, N_FL_FLUX );
+
+      if ( ! FaceMask[d][idx_flux] )   continue;
+
+//    (i_flux, j_flux, k_flux) is the left face of the output cell with the same index along d
+      const int idx_R = IDX321( i_flux+FLU_GHOST_SIZE, j_flux+FLU_GHOST_SIZE, k_flux+FLU_GHOST_SIZE, FLU_NXT, FLU_NXT );
+      const int idx_L = idx_R - didx_in[d];
+
+      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+      {
+         ConVar_L[v] = g_ConVar[v][idx_L];
+         ConVar_R[v] = g_ConVar[v][idx_R];
+      }
+
+#     if   ( RSOLVER == EXACT )
+      Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                 EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                 EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     elif ( RSOLVER == ROE )
+      Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                 EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                 EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     elif ( RSOLVER == HLLE )
+      Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                 EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                 EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     elif ( RSOLVER == HLLC )
+      Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                 EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                 EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#     else
+#     error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC) !!
+#     endif
+
+      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_FC_Flux[d][v][idx_flux] = Flux_1Face[v];
+
+//    only the faces between the two patches along d within the patch group are both inner and inter-patch faces
+      const int ijk_flux[3] = { i_flux, j_flux, k_flux };
+
+      if ( DumpIntFlux  &&  ijk_flux[d] == PS1 )
+      {
+         const int int_face = 3*d + 1;
+         const int int_idx  = ( d == 0 ) ? k_flux*PS2 + j_flux :
+                              ( d == 1 ) ? k_flux*PS2 + i_flux :
+                                           j_flux*PS2 + i_flux;
+
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+      }
+   } // d,i,j,k
+
+} // FUNCTION : Hydro_LocalFallback
+#endif // #if ( !defined __CUDACC__  &&  !defined MHD )
+
+
+
 #endif // #if (  MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  )
@@ -61,9 +61,36 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
                                const int EoS_AuxArray_Int[], const real* const EoS_Table[EOS_NTABLE_MAX] );
 #endif
 
+#if   ( defined RSOLVER_ROW  &&  RSOLVER == HLLC )
+void Hydro_RiemannSolver_HLLC_Row( const int XYZ, const int NFace, real Flux_Out[][N_RSOLVER_ROW],
+                                   const real L_In[][N_RSOLVER_ROW], const real R_In[][N_RSOLVER_ROW],
+                                   const real MinPres, const double EoS_AuxArray_Flt[] );
+#elif ( defined RSOLVER_ROW  &&  RSOLVER == HLLE )
+void Hydro_RiemannSolver_HLLE_Row( const int XYZ, const int NFace, real Flux_Out[][N_RSOLVER_ROW],
+                                   const real L_In[][N_RSOLVER_ROW], const real R_In[][N_RSOLVER_ROW],
+                                   const real MinPres, const double EoS_AuxArray_Flt[] );
+#endif
+
 #endif // #ifdef __CUDACC__ ... else ...
 
 
+// internal functions (GPU_DEVICE is defined in CUFLU.h)
+#ifdef UNSPLIT_GRAVITY
+GPU_DEVICE
+static void Hydro_CorrHalfVel( real ConVar_L[], real ConVar_R[], const int d, const int i_fc, const int j_fc, const int k_fc,
+                               const real g_Pot_USG[], const double CrShift[], const real dt, const real dh, const double Time,
+                               const bool UsePot, const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] );
+#endif
+#if ( RSOLVER_RESCUE != NONE )
+GPU_DEVICE
+static void Hydro_RescueFlux( const int d, real Flux_1Face[], const real ConVar_L[], const real ConVar_R[],
+                              const real MinDens, const real MinPres, const EoS_t *EoS );
+#endif
+GPU_DEVICE
+static void Hydro_StoreIntFlux( const int d, const int i_flux, const int j_flux, const int k_flux, const real Flux_1Face[],
+                                real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] );
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -86,6 +113,12 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
 //                   --> Option "DumpIntFlux"
 //                6. For the unsplitting scheme in gravity (i.e., UNSPLIT_GRAVITY), this function also corrects the half-step
 //                   velocity by gravity when CorrHalfVel==true
+//                7. On CPU, the Riemann problems are solved N_RSOLVER_ROW interfaces at a time by the batched
+//                   Riemann solvers when RSOLVER_ROW is on (see CUFLU.h)
+//                8. Only the fluxes with k_flux_s <= k < k_flux_e in g_FC_Flux[] are computed
+//                   --> k_flux_e is truncated to the number of fluxes along z in each direction
+//                   --> Set k_flux_s=0 and k_flux_e=N_FC_VAR to compute all fluxes
+//                   --> Used by FLU_TILE in CUFLU.h
 //
 // Parameter   :  g_FC_Var        : Array storing the input face-centered conserved variables
 //                g_FC_Flux       : Array to store the output face-centered fluxes
@@ -108,6 +141,7 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
 //                DumpIntFlux     : true --> store the inter-patch fluxes in g_IntFlux[]
 //                g_IntFlux       : Array for DumpIntFlux
 //                EoS             : EoS object
+//                k_flux_s/e      : Range of the fluxes along z to be computed (see Note 8)
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
@@ -118,7 +152,7 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
                         const real MinDens, const real MinPres, const bool DumpIntFlux,
                         real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
-                        const EoS_t *EoS )
+                        const EoS_t *EoS, const int k_flux_s, const int k_flux_e )
 {
 
 // check
@@ -146,13 +180,13 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
    real ConVar_L[NCOMP_TOTAL_PLUS_MAG], ConVar_R[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
 
+#  ifdef RSOLVER_ROW
+   real Row_L[NCOMP_TOTAL][N_RSOLVER_ROW], Row_R[NCOMP_TOTAL][N_RSOLVER_ROW], Row_Flux[NCOMP_TOTAL][N_RSOLVER_ROW];
+#  endif
+
 #  ifdef UNSPLIT_GRAVITY
-   const real   GraConst    = -(real)0.5*dt/dh;
-   const int    didx_usg[3] = { 1, USG_NXT_F, SQR(USG_NXT_F) };
-   const int    fc_ghost    = ( N_FC_VAR - PS2 )/2;         // number of ghost zones on each side for g_FC_Var[]
-   const int    idx_fc2usg  = USG_GHOST_SIZE_F - fc_ghost;  // index difference between g_FC_Var[] and g_Pot_USG[]
-   const double dh_half     = 0.5*(double)dh;               // always use double precision to calculate the cell position
-   const real   dt_half     = (real)0.5*dt;
+   const int fc_ghost   = ( N_FC_VAR - PS2 )/2;         // number of ghost zones on each side for g_FC_Var[]
+   const int idx_fc2usg = USG_GHOST_SIZE_F - fc_ghost;  // index difference between g_FC_Var[] and g_Pot_USG[]
 
    double CrShift[3] = { 0.0 };
 
@@ -183,17 +217,6 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
       const int faceL = 2*d;
       const int faceR = faceL+1;
 
-#     ifdef UNSPLIT_GRAVITY
-      int d1, d2, d3;
-
-      if ( CorrHalfVel )
-      {
-         d1 =  d;
-         d2 = (d+1)%3;
-         d3 = (d+2)%3;
-      }
-#     endif
-
       int idx_fc_s[3], idx_flux_e[3];
 
       switch ( d )
@@ -212,8 +235,89 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
       }
 
       const int size_ij = idx_flux_e[0]*idx_flux_e[1];
-      CGPU_LOOP( idx, idx_flux_e[0]*idx_flux_e[1]*idx_flux_e[2] )
+      const int idx_s   = size_ij*k_flux_s;
+      const int idx_e   = size_ij*MIN( k_flux_e, idx_flux_e[2] );
+
+#     ifdef RSOLVER_ROW
+//    solve N_RSOLVER_ROW Riemann problems at a time
+      for (int idx0=idx_s; idx0<idx_e; idx0+=N_RSOLVER_ROW)
       {
+         const int NRow = MIN( N_RSOLVER_ROW, idx_e-idx0 );
+
+//       1. collect the left/right states and correct the half-step velocity by gravity
+         for (int t=0; t<NRow; t++)
+         {
+            const int idx    = idx0 + t;
+            const int i_fc   = idx % idx_flux_e[0]           + idx_fc_s[0];
+            const int j_fc   = idx % size_ij / idx_flux_e[0] + idx_fc_s[1];
+            const int k_fc   = idx / size_ij                 + idx_fc_s[2];
+            const int idx_fc = IDX321( i_fc, j_fc, k_fc, N_FC_VAR, N_FC_VAR );
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            {
+               ConVar_L[v] = g_FC_Var[faceR][v][ idx_fc            ];
+               ConVar_R[v] = g_FC_Var[faceL][v][ idx_fc+didx_fc[d] ];
+            }
+
+#           ifdef UNSPLIT_GRAVITY
+            if ( CorrHalfVel )
+               Hydro_CorrHalfVel( ConVar_L, ConVar_R, d, i_fc, j_fc, k_fc, g_Pot_USG, CrShift, dt, dh, Time,
+                                  UsePot, ExtAcc, ExtAcc_Func, ExtAcc_AuxArray );
+#           endif
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            {
+               Row_L[v][t] = ConVar_L[v];
+               Row_R[v][t] = ConVar_R[v];
+            }
+         } // for (int t=0; t<NRow; t++)
+
+
+//       2. invoke the batched Riemann solver
+#        if   ( RSOLVER == HLLC )
+         Hydro_RiemannSolver_HLLC_Row( d, NRow, Row_Flux, Row_L, Row_R, MinPres, EoS->AuxArrayDevPtr_Flt );
+#        elif ( RSOLVER == HLLE )
+         Hydro_RiemannSolver_HLLE_Row( d, NRow, Row_Flux, Row_L, Row_R, MinPres, EoS->AuxArrayDevPtr_Flt );
+#        else
+#        error : ERROR : unsupported Riemann solver for RSOLVER_ROW (HLLC/HLLE) !!
+#        endif
+
+
+         for (int t=0; t<NRow; t++)
+         {
+            const int idx      = idx0 + t;
+            const int i_flux   = idx % idx_flux_e[0];
+            const int j_flux   = idx % size_ij / idx_flux_e[0];
+            const int k_flux   = idx / size_ij;
+            const int idx_flux = IDX321( i_flux, j_flux, k_flux, NFlux, NFlux );
+
+            for (int v=0; v<NCOMP_TOTAL; v++)   Flux_1Face[v] = Row_Flux[v][t];
+
+//          3. switch to a different Riemann solver if the default one fails
+#           if ( RSOLVER_RESCUE != NONE )
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            {
+               ConVar_L[v] = Row_L[v][t];
+               ConVar_R[v] = Row_R[v][t];
+            }
+
+            Hydro_RescueFlux( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS );
+#           endif
+
+//          4. store the fluxes of all cells in g_FC_Flux[]
+            for (int v=0; v<NCOMP_TOTAL; v++)   g_FC_Flux[d][v][idx_flux] = Flux_1Face[v];
+
+//          5. store the inter-patch fluxes in g_IntFlux[]
+            if ( DumpIntFlux )
+               Hydro_StoreIntFlux( d, i_flux, j_flux, k_flux, Flux_1Face, g_IntFlux );
+         } // for (int t=0; t<NRow; t++)
+      } // for (int idx0=idx_s; idx0<idx_e; idx0+=N_RSOLVER_ROW)
+
+#     else // #ifdef RSOLVER_ROW
+
+      CGPU_LOOP( t, idx_e-idx_s )
+      {
+         const int idx      = idx_s + t;
          const int i_flux   = idx % idx_flux_e[0];
          const int j_flux   = idx % size_ij / idx_flux_e[0];
          const int k_flux   = idx / size_ij;
@@ -234,53 +338,9 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 //       1. correct the half-step velocity by gravity
 #        ifdef UNSPLIT_GRAVITY
          if ( CorrHalfVel )
-         {
-            real Acc[3] = { (real)0.0, (real)0.0, (real)0.0 };
-            real Enki_L, Enki_R;
-
-//          external acceleration
-            if ( ExtAcc )
-            {
-               double xyz[3]; // face-centered coordinates
-
-               xyz[0]  = CrShift[0] + (double)(i_fc*dh);
-               xyz[1]  = CrShift[1] + (double)(j_fc*dh);
-               xyz[2]  = CrShift[2] + (double)(k_fc*dh);
-               xyz[d] += dh_half;
-
-               ExtAcc_Func( Acc, xyz[0], xyz[1], xyz[2], Time, ExtAcc_AuxArray );
-
-               for (int t=0; t<3; t++)    Acc[t] *= dt_half;
-            }
-
-//          self-gravity and external potential
-            if ( UsePot )
-            {
-               const int idx_usg = IDX321( i_fc+idx_fc2usg, j_fc+idx_fc2usg, k_fc+idx_fc2usg, USG_NXT_F, USG_NXT_F );
-
-               Acc[d1] +=            GraConst*( g_Pot_USG[ idx_usg+didx_usg[d1] ] - g_Pot_USG[ idx_usg                           ] );
-               Acc[d2] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d2] ] + g_Pot_USG[ idx_usg+didx_usg[d2]+didx_usg[d1] ]
-                                               -g_Pot_USG[ idx_usg-didx_usg[d2] ] - g_Pot_USG[ idx_usg-didx_usg[d2]+didx_usg[d1] ] );
-               Acc[d3] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d3] ] + g_Pot_USG[ idx_usg+didx_usg[d3]+didx_usg[d1] ]
-                                               -g_Pot_USG[ idx_usg-didx_usg[d3] ] - g_Pot_USG[ idx_usg-didx_usg[d3]+didx_usg[d1] ] );
-            }
-
-//          store the "non"-kinetic energy (i.e. total energy - kinetic energy)
-            Enki_L = ConVar_L[4] - (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
-            Enki_R = ConVar_R[4] - (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
-
-//          advance velocity by gravity
-            for (int t=0; t<3; t++)
-            {
-               ConVar_L[t+1] += ConVar_L[0]*Acc[t];
-               ConVar_R[t+1] += ConVar_R[0]*Acc[t];
-            }
-
-//          update total energy density with the non-kinetic energy fixed
-            ConVar_L[4] = Enki_L + (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
-            ConVar_R[4] = Enki_R + (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
-         } // if ( CorrHalfVel )
-#        endif // #ifdef UNSPLIT_GRAVITY
+            Hydro_CorrHalfVel( ConVar_L, ConVar_R, d, i_fc, j_fc, k_fc, g_Pot_USG, CrShift, dt, dh, Time,
+                               UsePot, ExtAcc, ExtAcc_Func, ExtAcc_AuxArray );
+#        endif
 
 
 //       2. invoke Riemann solver
@@ -311,53 +371,8 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 //       3. switch to a different Riemann solver if the default one fails
 #        if ( RSOLVER_RESCUE != NONE )
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
-         {
-//          only check NaN for now
-            if ( Flux_1Face[v] != Flux_1Face[v] )
-            {
-#              ifdef CHECK_UNPHYSICAL_IN_FLUID
-               printf( "WARNING : default Riemann solver failed in Hydro_ComputeFlux() --> switch to RSOLVER_RESCUE (%d) !!\n", RSOLVER_RESCUE );
-#              endif
-
-#              if   ( RSOLVER_RESCUE == EXACT  &&  !defined MHD )
-               Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == ROE )
-               Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == HLLE )
-               Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == HLLC  &&  !defined MHD )
-               Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              elif ( RSOLVER_RESCUE == HLLD  &&  defined MHD )
-               Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
-                                          EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
-                                          EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-#              else
-#              error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
-#              endif
-
-//             check again
-#              ifdef CHECK_UNPHYSICAL_IN_FLUID
-               for (int w=0; w<NCOMP_TOTAL_PLUS_MAG; w++) {
-                  if ( Flux_1Face[w] != Flux_1Face[w] ) {
-                     printf( "ERROR : RSOLVER_RESCUE still failed !!\n" );
-                     break;
-                  }
-               }
-#              endif
-
-               break;
-            } // if ( Flux_1Face[v] != Flux_1Face[v] )
-         } // for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
-#        endif // #if ( RSOLVER_RESCUE != NONE )
+         Hydro_RescueFlux( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres, EoS );
+#        endif
 
 
 //       4. store the fluxes of all cells in g_FC_Flux[]
@@ -366,63 +381,10 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 
 //       5. store the inter-patch fluxes in g_IntFlux[]
-//       --> no need to store the magnetic components since this array is only for the flux fix-up operation
          if ( DumpIntFlux )
-         {
-            int int_face, int_idx;
-
-//          we have assumed N_FC_VAR=PS2+2 for pure hydro
-//          --> for MHD, one additional flux is evaluated along each transverse direction for computing the CT electric field
-//          --> must exclude it when storing the inter-patch fluxes
-            if (  d == 0  &&  ( i_flux == 0 || i_flux == PS1 || i_flux == PS2 )  )
-            {
-#              ifdef MHD
-               if ( j_flux > 0  &&  j_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
-#              endif
-               {
-                  int_face = i_flux/PS1;
-#                 ifdef MHD
-                  int_idx  = (k_flux-1)*PS2 + j_flux-1;
-#                 else
-                  int_idx  = (k_flux  )*PS2 + j_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
-               }
-            }
-
-            else if (  d == 1  &&  ( j_flux == 0 || j_flux == PS1 || j_flux == PS2 )  )
-            {
-#              ifdef MHD
-               if ( i_flux > 0  &&  i_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
-#              endif
-               {
-                  int_face = j_flux/PS1 + 3;
-#                 ifdef MHD
-                  int_idx  = (k_flux-1)*PS2 + i_flux-1;
-#                 else
-                  int_idx  = (k_flux  )*PS2 + i_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
-               }
-            }
-
-            else if (  d == 2  &&  ( k_flux == 0 || k_flux == PS1 || k_flux == PS2 )  )
-            {
-#              ifdef MHD
-               if ( i_flux > 0  &&  i_flux < PS2+1  &&  j_flux > 0  &&  j_flux < PS2+1 )
-#              endif
-               {
-                  int_face = k_flux/PS1 + 6;
-#                 ifdef MHD
-                  int_idx  = (j_flux-1)*PS2 + i_flux-1;
-#                 else
-                  int_idx  = (j_flux  )*PS2 + i_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
-               }
-            }
-         } // if ( DumpIntFlux )
+            Hydro_StoreIntFlux( d, i_flux, j_flux, k_flux, Flux_1Face, g_IntFlux );
       } // i,j,k
+#     endif // #ifdef RSOLVER_ROW ... else ...
    } // for (int d=0; d<3; d++)
 
 
@@ -434,6 +396,232 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 
 
+#ifdef UNSPLIT_GRAVITY
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_CorrHalfVel
+// Description :  Correct the half-step velocity of the left/right states of one interface by gravity
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux() for UNSPLIT_GRAVITY
+//                2. Total energy is updated with the non-kinetic energy fixed
+//
+// Parameter   :  ConVar_L/R      : Left/right states to be corrected
+//                d               : Target spatial direction : (0/1/2) --> (x/y/z)
+//                i/j/k_fc        : Cell indices in g_FC_Var[]
+//                g_Pot_USG       : Array storing the input potential
+//                CrShift         : Central coordinates of the 0th cell in g_FC_Var[]
+//                Others          : See Hydro_ComputeFlux()
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void Hydro_CorrHalfVel( real ConVar_L[], real ConVar_R[], const int d, const int i_fc, const int j_fc, const int k_fc,
+                               const real g_Pot_USG[], const double CrShift[], const real dt, const real dh, const double Time,
+                               const bool UsePot, const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[] )
+{
+
+   const real   GraConst    = -(real)0.5*dt/dh;
+   const int    didx_usg[3] = { 1, USG_NXT_F, SQR(USG_NXT_F) };
+   const int    fc_ghost    = ( N_FC_VAR - PS2 )/2;         // number of ghost zones on each side for g_FC_Var[]
+   const int    idx_fc2usg  = USG_GHOST_SIZE_F - fc_ghost;  // index difference between g_FC_Var[] and g_Pot_USG[]
+   const double dh_half     = 0.5*(double)dh;               // always use double precision to calculate the cell position
+   const real   dt_half     = (real)0.5*dt;
+   const int    d1          =  d;
+   const int    d2          = (d+1)%3;
+   const int    d3          = (d+2)%3;
+
+   real Acc[3] = { (real)0.0, (real)0.0, (real)0.0 };
+   real Enki_L, Enki_R;
+
+// external acceleration
+   if ( ExtAcc )
+   {
+      double xyz[3]; // face-centered coordinates
+
+      xyz[0]  = CrShift[0] + (double)(i_fc*dh);
+      xyz[1]  = CrShift[1] + (double)(j_fc*dh);
+      xyz[2]  = CrShift[2] + (double)(k_fc*dh);
+      xyz[d] += dh_half;
+
+      ExtAcc_Func( Acc, xyz[0], xyz[1], xyz[2], Time, ExtAcc_AuxArray );
+
+      for (int t=0; t<3; t++)    Acc[t] *= dt_half;
+   }
+
+// self-gravity and external potential
+   if ( UsePot )
+   {
+      const int idx_usg = IDX321( i_fc+idx_fc2usg, j_fc+idx_fc2usg, k_fc+idx_fc2usg, USG_NXT_F, USG_NXT_F );
+
+      Acc[d1] +=            GraConst*( g_Pot_USG[ idx_usg+didx_usg[d1] ] - g_Pot_USG[ idx_usg                           ] );
+      Acc[d2] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d2] ] + g_Pot_USG[ idx_usg+didx_usg[d2]+didx_usg[d1] ]
+                                      -g_Pot_USG[ idx_usg-didx_usg[d2] ] - g_Pot_USG[ idx_usg-didx_usg[d2]+didx_usg[d1] ] );
+      Acc[d3] += (real)0.25*GraConst*( g_Pot_USG[ idx_usg+didx_usg[d3] ] + g_Pot_USG[ idx_usg+didx_usg[d3]+didx_usg[d1] ]
+                                      -g_Pot_USG[ idx_usg-didx_usg[d3] ] - g_Pot_USG[ idx_usg-didx_usg[d3]+didx_usg[d1] ] );
+   }
+
+// store the "non"-kinetic energy (i.e. total energy - kinetic energy)
+   Enki_L = ConVar_L[4] - (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
+   Enki_R = ConVar_R[4] - (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+
+// advance velocity by gravity
+   for (int t=0; t<3; t++)
+   {
+      ConVar_L[t+1] += ConVar_L[0]*Acc[t];
+      ConVar_R[t+1] += ConVar_R[0]*Acc[t];
+   }
+
+// update total energy density with the non-kinetic energy fixed
+   ConVar_L[4] = Enki_L + (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
+   ConVar_R[4] = Enki_R + (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+
+} // FUNCTION : Hydro_CorrHalfVel
+#endif // #ifdef UNSPLIT_GRAVITY
+
+
+
+#if ( RSOLVER_RESCUE != NONE )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RescueFlux
+// Description :  Recompute the flux of one interface by RSOLVER_RESCUE if the default Riemann solver fails
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux()
+//                2. Only check NaN for now
+//
+// Parameter   :  d            : Target spatial direction : (0/1/2) --> (x/y/z)
+//                Flux_1Face   : Flux computed by the default Riemann solver to be checked and corrected
+//                ConVar_L/R   : Input left/right states
+//                MinDens/Pres : Density and pressure floors
+//                EoS          : EoS object
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void Hydro_RescueFlux( const int d, real Flux_1Face[], const real ConVar_L[], const real ConVar_R[],
+                              const real MinDens, const real MinPres, const EoS_t *EoS )
+{
+
+   for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+   {
+//    only check NaN for now
+      if ( Flux_1Face[v] != Flux_1Face[v] )
+      {
+#        ifdef CHECK_UNPHYSICAL_IN_FLUID
+         printf( "WARNING : default Riemann solver failed in Hydro_ComputeFlux() --> switch to RSOLVER_RESCUE (%d) !!\n", RSOLVER_RESCUE );
+#        endif
+
+#        if   ( RSOLVER_RESCUE == EXACT  &&  !defined MHD )
+         Hydro_RiemannSolver_Exact( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#        elif ( RSOLVER_RESCUE == ROE )
+         Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#        elif ( RSOLVER_RESCUE == HLLE )
+         Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#        elif ( RSOLVER_RESCUE == HLLC  &&  !defined MHD )
+         Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#        elif ( RSOLVER_RESCUE == HLLD  &&  defined MHD )
+         Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, MinDens, MinPres,
+                                    EoS->DensEint2Pres_FuncPtr, EoS->DensPres2CSqr_FuncPtr,
+                                    EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+#        else
+#        error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
+#        endif
+
+//       check again
+#        ifdef CHECK_UNPHYSICAL_IN_FLUID
+         for (int w=0; w<NCOMP_TOTAL_PLUS_MAG; w++) {
+            if ( Flux_1Face[w] != Flux_1Face[w] ) {
+               printf( "ERROR : RSOLVER_RESCUE still failed !!\n" );
+               break;
+            }
+         }
+#        endif
+
+         break;
+      } // if ( Flux_1Face[v] != Flux_1Face[v] )
+   } // for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+
+} // FUNCTION : Hydro_RescueFlux
+#endif // #if ( RSOLVER_RESCUE != NONE )
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_StoreIntFlux
+// Description :  Store the flux of one interface in g_IntFlux[] if it lies on a patch boundary
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux() when DumpIntFlux is on
+//                2. No need to store the magnetic components since g_IntFlux[] is only for the flux fix-up operation
+//
+// Parameter   :  d          : Target spatial direction : (0/1/2) --> (x/y/z)
+//                i/j/k_flux : Flux indices
+//                Flux_1Face : Flux to be stored
+//                g_IntFlux  : Array to store the inter-patch fluxes
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void Hydro_StoreIntFlux( const int d, const int i_flux, const int j_flux, const int k_flux, const real Flux_1Face[],
+                                real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] )
+{
+
+   int int_face, int_idx;
+
+// we have assumed N_FC_VAR=PS2+2 for pure hydro
+// --> for MHD, one additional flux is evaluated along each transverse direction for computing the CT electric field
+// --> must exclude it when storing the inter-patch fluxes
+   if (  d == 0  &&  ( i_flux == 0 || i_flux == PS1 || i_flux == PS2 )  )
+   {
+#     ifdef MHD
+      if ( j_flux > 0  &&  j_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
+#     endif
+      {
+         int_face = i_flux/PS1;
+#        ifdef MHD
+         int_idx  = (k_flux-1)*PS2 + j_flux-1;
+#        else
+         int_idx  = (k_flux  )*PS2 + j_flux;
+#        endif
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+      }
+   }
+
+   else if (  d == 1  &&  ( j_flux == 0 || j_flux == PS1 || j_flux == PS2 )  )
+   {
+#     ifdef MHD
+      if ( i_flux > 0  &&  i_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
+#     endif
+      {
+         int_face = j_flux/PS1 + 3;
+#        ifdef MHD
+         int_idx  = (k_flux-1)*PS2 + i_flux-1;
+#        else
+         int_idx  = (k_flux  )*PS2 + i_flux;
+#        endif
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+      }
+   }
+
+   else if (  d == 2  &&  ( k_flux == 0 || k_flux == PS1 || k_flux == PS2 )  )
+   {
+#     ifdef MHD
+      if ( i_flux > 0  &&  i_flux < PS2+1  &&  j_flux > 0  &&  j_flux < PS2+1 )
+#     endif
+      {
+         int_face = k_flux/PS1 + 6;
+#        ifdef MHD
+         int_idx  = (j_flux-1)*PS2 + i_flux-1;
+#        else
+         int_idx  = (j_flux  )*PS2 + i_flux;
+#        endif
+         for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+      }
+   }
+
+} // FUNCTION : Hydro_StoreIntFlux
+
+
+
 #endif // #if ( MODEL == HYDRO  &&  (FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU) )
 
 
@@ -36,11 +36,23 @@ void Hydro_Con2Flux( const int XYZ, real Flux[], const real In[], const real Min
 
 
 // internal functions (GPU_DEVICE is defined in CUFLU.h)
+#ifdef LR_PENCIL
+static void Hydro_LimitSlope_Pencil( const real L[], const real C[], const real R[], const int N,
+                                     const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, real Slope_Limiter[] );
+static void Hydro_FC_Pri2Con( const real g_ConVar[][ CUBE(FLU_NXT) ],
+                                    real g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                              const int NIn, const int NGhost, const int k_fc_s, const int k_fc_e,
+                              const real dt, const real dh,
+                              const real MinDens, const real MinPres, const real MinEint,
+                              const bool FracPassive, const int NFrac, const int FracIdx[],
+                              const EoS_t *EoS );
+#else
 GPU_DEVICE
 static void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_Limiter_t LR_Limiter,
                               const real MinMod_Coeff, const int XYZ,
                               const real LEigenVec[][NWAVE], const real REigenVec[][NWAVE], real Slope_Limiter[],
                               const EoS_t *EoS );
+#endif
 #if (  FLU_SCHEME == CTU  ||  ( defined MHD && defined CHAR_RECONSTRUCTION )  )
 #ifdef MHD
 GPU_DEVICE
@@ -105,6 +117,11 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                9. Support applying data reconstruction to internal energy and using that instead of pressure
 //                   for converting primitive variables to conserved variables
 //                   --> Controlled by the option "LR_EINT" in CUFLU.h; see the description thereof for details
+//               10. Only the z-slabs k_fc_s <= k < k_fc_e of g_FC_Var[] are computed when LR_PENCIL is on
+//                   --> Used by FLU_TILE in CUFLU.h, which must invoke this function for consecutive ranges in
+//                       ascending order since the primitive variables and PPM slopes shared with the previous
+//                       range are not recomputed
+//                   --> Other cases must compute the entire array (i.e., k_fc_s=0 and k_fc_e=N_FC_VAR)
 //
 // Parameter   :  g_ConVar           : Array storing the input cell-centered conserved variables
 //                                     --> Should contain NCOMP_TOTAL variables
@@ -143,6 +160,7 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
 //                EoS                : EoS object
+//                k_fc_s/e           : Range of the z-slabs in g_FC_Var[] to be computed (see Note 10)
 //------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
@@ -155,7 +173,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real MinDens, const real MinPres, const real MinEint,
                                const bool FracPassive, const int NFrac, const int FracIdx[],
                                const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS )
+                               const EoS_t *EoS, const int k_fc_s, const int k_fc_e )
 {
 
 //### NOTE: temporary solution to the bug in cuda 10.1 and 10.2 that incorrectly overwrites didx_cc[]
@@ -180,6 +198,12 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #  if ( defined LR_EINT  &&  FLU_SCHEME == CTU )
 #     error : CTU does NOT support LR_EINT !!
 #  endif
+
+#  ifndef LR_PENCIL
+   if ( k_fc_s != 0  ||  k_fc_e != N_FC_VAR )
+      printf( "ERROR : only LR_PENCIL supports a partial range of z-slabs (k_fc_s %d, k_fc_e %d, N_FC_VAR %d) !!\n",
+              k_fc_s, k_fc_e, N_FC_VAR );
+#  endif
 #  endif // GAMER_DEBUG
 
 
@@ -247,10 +271,10 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                     { 0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
                                     { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL } };
 
-#  else // #if ( FLU_SCHEME == CTU ) ... elif ...
+#  elif ( !defined LR_PENCIL ) // #if ( FLU_SCHEME == CTU ) ... elif ...
    real (*const REigenVec)[NWAVE] = NULL;
    real (*const LEigenVec)[NWAVE] = NULL;
-#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... else ...
+#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... elif ...
 
 
 // 0. conserved --> primitive variables
@@ -264,8 +288,19 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real* const EintPtr = NULL;
 #     endif
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+//    skip the cells already converted for the previous z-slabs
+#     ifdef LR_PENCIL
+      const int idx_s = ( k_fc_s == 0 ) ? 0 : SQR(NIn)*( k_fc_s + 2*NGhost );
+      const int idx_e = SQR(NIn)*( k_fc_e + 2*NGhost );
+#     else
+      const int idx_s = 0;
+      const int idx_e = CUBE(NIn);
+#     endif
+
+      CGPU_LOOP( t, idx_e-idx_s )
       {
+         const int idx = idx_s + t;
+
          for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
@@ -287,7 +322,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #        ifdef LR_EINT
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
-      } // CGPU_LOOP( idx, CUBE(NIn) )
+      } // CGPU_LOOP( t, idx_e-idx_s )
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -295,6 +330,66 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    } // if ( Con2Pri )
 
 
+#  ifdef LR_PENCIL
+// 1. evaluate the monotonic slope and get the face-centered primitive variables along the x-direction pencils
+//    --> same operations as steps 2 and 3 below but applied to a whole row of one variable at a time
+   real Slope_Limiter[N_FC_VAR];
+
+   for (int d=0; d<3; d++)
+   {
+      const int faceL = 2*d;  // left and right face indices
+      const int faceR = faceL+1;
+
+      for (int v=0; v<NCOMP_LR; v++)
+      for (int k_fc=k_fc_s; k_fc<k_fc_e; k_fc++)
+      for (int j_fc=0; j_fc<N_FC_VAR; j_fc++)
+      {
+         const int   idx_fc = IDX321( 0, j_fc, k_fc, N_FC_VAR, N_FC_VAR );
+         const int   idx_cc = IDX321( NGhost, NGhost+j_fc, NGhost+k_fc, NIn, NIn );
+         const real *cc     = g_PriVar[v] + idx_cc;
+               real *fcL    = g_FC_Var[faceL][v] + idx_fc;
+               real *fcR    = g_FC_Var[faceR][v] + idx_fc;
+
+         Hydro_LimitSlope_Pencil( cc-didx_cc[d], cc, cc+didx_cc[d], N_FC_VAR, LR_Limiter, MinMod_Coeff,
+                                  Slope_Limiter );
+
+#        pragma omp simd
+         for (int i=0; i<N_FC_VAR; i++)
+         {
+//          cc_C/L/R: cell-centered variables of the Central/Left/Right cells
+            const real cc_C = cc[i];
+            const real cc_L = cc[ i - didx_cc[d] ];
+            const real cc_R = cc[ i + didx_cc[d] ];
+            real fc_L, fc_R, Min, Max;
+
+//          ensure the face-centered variables lie between neighboring cell-centered values
+            fc_L = cc_C - (real)0.5*Slope_Limiter[i];
+
+            Min  = ( cc_C < cc_L ) ? cc_C : cc_L;
+            Max  = ( cc_C > cc_L ) ? cc_C : cc_L;
+            fc_L = ( fc_L > Min ) ? fc_L : Min;
+            fc_L = ( fc_L < Max ) ? fc_L : Max;
+            fc_R = (real)2.0*cc_C - fc_L;
+
+            Min  = ( cc_C < cc_R ) ? cc_C : cc_R;
+            Max  = ( cc_C > cc_R ) ? cc_C : cc_R;
+            fc_R = ( fc_R > Min ) ? fc_R : Min;
+            fc_R = ( fc_R < Max ) ? fc_R : Max;
+            fc_L = (real)2.0*cc_C - fc_R;
+
+            fcL[i] = fc_L;
+            fcR[i] = fc_R;
+         } // for (int i=0; i<N_FC_VAR; i++)
+      } // v, k_fc, j_fc
+   } // for (int d=0; d<3; d++)
+
+
+// 2. primitive variables --> conserved variables and advance them by half time-step for MHM
+   Hydro_FC_Pri2Con( g_ConVar, g_FC_Var, NIn, NGhost, k_fc_s, k_fc_e, dt, dh, MinDens, MinPres, MinEint,
+                     FracPassive, NFrac, FracIdx, EoS );
+
+#  else // #ifdef LR_PENCIL
+
 // data reconstruction
    const int N_FC_VAR2 = SQR( N_FC_VAR );
 #  ifdef MHD
@@ -620,6 +715,8 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
    } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
 
+#  endif // #ifdef LR_PENCIL ... else ...
+
 
 #  ifdef __CUDACC__
    __syncthreads();
@@ -650,7 +747,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real MinDens, const real MinPres, const real MinEint,
                                const bool FracPassive, const int NFrac, const int FracIdx[],
                                const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS )
+                               const EoS_t *EoS, const int k_fc_s, const int k_fc_e )
 {
 
 //### NOTE: temporary solution to the bug in cuda 10.1 and 10.2 that incorrectly overwrites didx_cc[]
@@ -679,6 +776,12 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #  if ( defined LR_EINT  &&  FLU_SCHEME == CTU )
 #     error : CTU does NOT support LR_EINT !!
 #  endif
+
+#  ifndef LR_PENCIL
+   if ( k_fc_s != 0  ||  k_fc_e != N_FC_VAR )
+      printf( "ERROR : only LR_PENCIL supports a partial range of z-slabs (k_fc_s %d, k_fc_e %d, N_FC_VAR %d) !!\n",
+              k_fc_s, k_fc_e, N_FC_VAR );
+#  endif
 #  endif // GAMER_DEBUG
 
 
@@ -756,10 +859,10 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                     { 0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
                                     { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL } };
 
-#  else // #if ( FLU_SCHEME == CTU ) ... elif ...
+#  elif ( !defined LR_PENCIL ) // #if ( FLU_SCHEME == CTU ) ... elif ...
    real (*const REigenVec)[NWAVE] = NULL;
    real (*const LEigenVec)[NWAVE] = NULL;
-#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... else ...
+#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... elif ...
 
 
 // 0. conserved --> primitive variables
@@ -773,8 +876,19 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real* const EintPtr = NULL;
 #     endif
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+//    skip the cells already converted for the previous z-slabs
+#     ifdef LR_PENCIL
+      const int idx_s = ( k_fc_s == 0 ) ? 0 : SQR(NIn)*( k_fc_s + 2*NGhost );
+      const int idx_e = SQR(NIn)*( k_fc_e + 2*NGhost );
+#     else
+      const int idx_s = 0;
+      const int idx_e = CUBE(NIn);
+#     endif
+
+      CGPU_LOOP( t, idx_e-idx_s )
       {
+         const int idx = idx_s + t;
+
          for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
@@ -796,7 +910,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #        ifdef LR_EINT
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
-      } // CGPU_LOOP( idx, CUBE(NIn) )
+      } // CGPU_LOOP( t, idx_e-idx_s )
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -804,6 +918,102 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    } // if ( Con2Pri )
 
 
+#  ifdef LR_PENCIL
+// 1. evaluate the monotonic slope of all cells along the x-direction pencils
+//    --> skip the slopes already evaluated for the previous z-slabs
+   const int k_slope_s = ( k_fc_s == 0 ) ? 0 : k_fc_s + 2;
+   const int k_slope_e = k_fc_e + 2;
+
+   for (int d=0; d<3; d++)
+   for (int v=0; v<NCOMP_LR; v++)
+   for (int k_slope=k_slope_s; k_slope<k_slope_e; k_slope++)
+   for (int j_slope=0; j_slope<N_SLOPE_PPM; j_slope++)
+   {
+      const int   idx_slope = IDX321( 0, j_slope, k_slope, N_SLOPE_PPM, N_SLOPE_PPM );
+      const int   idx_cc    = IDX321( NGhost-1, NGhost-1+j_slope, NGhost-1+k_slope, NIn, NIn );
+      const real *cc_C      = g_PriVar[v] + idx_cc;
+
+      Hydro_LimitSlope_Pencil( cc_C-didx_cc[d], cc_C, cc_C+didx_cc[d], N_SLOPE_PPM, LR_Limiter, MinMod_Coeff,
+                               g_Slope_PPM[d][v]+idx_slope );
+   }
+
+
+// 2. get the face-centered primitive variables along the x-direction pencils and store them in g_FC_Var[]
+//    --> same operations as steps 3-1 ~ 3-3 below but written branch-free
+   const bool Central = ( LR_Limiter == LR_LIMITER_CENTRAL );
+
+   for (int d=0; d<3; d++)
+   {
+      const int faceL = 2*d;  // left and right face indices
+      const int faceR = faceL+1;
+
+      for (int v=0; v<NCOMP_LR; v++)
+      for (int k_fc=k_fc_s; k_fc<k_fc_e; k_fc++)
+      for (int j_fc=0; j_fc<N_FC_VAR; j_fc++)
+      {
+         const int   idx_fc    = IDX321( 0, j_fc, k_fc, N_FC_VAR, N_FC_VAR );
+         const int   idx_cc    = IDX321( NGhost, NGhost+j_fc, NGhost+k_fc, NIn, NIn );
+         const int   idx_slope = IDX321( 1, j_fc+1, k_fc+1, N_SLOPE_PPM, N_SLOPE_PPM );
+         const real *cc        = g_PriVar[v] + idx_cc;
+         const real *dcc       = g_Slope_PPM[d][v] + idx_slope;
+               real *fcL       = g_FC_Var[faceL][v] + idx_fc;
+               real *fcR       = g_FC_Var[faceR][v] + idx_fc;
+
+#        pragma omp simd
+         for (int i=0; i<N_FC_VAR; i++)
+         {
+//          cc/fc: cell/face-centered variables; _C/L/R: Central/Left/Right cells
+            const real cc_C  = cc[i];
+            const real cc_L  = cc[ i - didx_cc[d] ];
+            const real cc_R  = cc[ i + didx_cc[d] ];
+            const real dcc_C = dcc[i];
+            const real dcc_L = dcc[ i - didx_slope[d] ];
+            const real dcc_R = dcc[ i + didx_slope[d] ];
+            real fc_L, fc_R, dfc, dfc6, Max, Min;
+
+            fc_L = (real)0.5*( cc_C + cc_L ) - (real)1.0/(real)6.0*( dcc_C - dcc_L );
+            fc_R = (real)0.5*( cc_C + cc_R ) - (real)1.0/(real)6.0*( dcc_R - dcc_C );
+
+            if ( Central )
+            {
+               fc_L = ( (cc_C-fc_L)*(fc_L-cc_L) < (real)0.0 ) ? (real)0.5*( cc_C + cc_L ) : fc_L;
+               fc_R = ( (cc_R-fc_R)*(fc_R-cc_C) < (real)0.0 ) ? (real)0.5*( cc_C + cc_R ) : fc_R;
+            }
+
+            dfc  = fc_R - fc_L;
+            dfc6 = (real)6.0*(  cc_C - (real)0.5*( fc_L + fc_R )  );
+
+//          the two steepening conditions below are mutually exclusive since dfc*dfc >= 0
+            const bool Flat   = (  ( fc_R - cc_C )*( cc_C - fc_L ) <= (real)0.0  );
+            const real fc_L_S = ( dfc*dfc6 > +dfc*dfc ) ? (real)3.0*cc_C - (real)2.0*fc_R : fc_L;
+            const real fc_R_S = ( dfc*dfc6 < -dfc*dfc ) ? (real)3.0*cc_C - (real)2.0*fc_L : fc_R;
+
+            fc_L = ( Flat ) ? cc_C : fc_L_S;
+            fc_R = ( Flat ) ? cc_C : fc_R_S;
+
+            Min  = ( cc_C < cc_L ) ? cc_C : cc_L;
+            Max  = ( cc_C > cc_L ) ? cc_C : cc_L;
+            fc_L = ( fc_L > Min  ) ? fc_L : Min;
+            fc_L = ( fc_L < Max  ) ? fc_L : Max;
+
+            Min  = ( cc_C < cc_R ) ? cc_C : cc_R;
+            Max  = ( cc_C > cc_R ) ? cc_C : cc_R;
+            fc_R = ( fc_R > Min  ) ? fc_R : Min;
+            fc_R = ( fc_R < Max  ) ? fc_R : Max;
+
+            fcL[i] = fc_L;
+            fcR[i] = fc_R;
+         } // for (int i=0; i<N_FC_VAR; i++)
+      } // v, k_fc, j_fc
+   } // for (int d=0; d<3; d++)
+
+
+// 3. primitive variables --> conserved variables and advance them by half time-step for MHM
+   Hydro_FC_Pri2Con( g_ConVar, g_FC_Var, NIn, NGhost, k_fc_s, k_fc_e, dt, dh, MinDens, MinPres, MinEint,
+                     FracPassive, NFrac, FracIdx, EoS );
+
+#  else // #ifdef LR_PENCIL
+
 // 1. evaluate the monotonic slope of all cells
    const int N_SLOPE_PPM2 = SQR( N_SLOPE_PPM );
    CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
@@ -1209,6 +1419,8 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
    } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
 
+#  endif // #ifdef LR_PENCIL ... else ...
+
 
 #  ifdef __CUDACC__
    __syncthreads();
@@ -1245,11 +1457,7 @@ void Hydro_Pri2Char( real InOut[], const real Dens, const real Pres, const real
 {
 
 // check
-#  if ( EOS == EOS_GAMMA )
-#  ifndef MHD
-   const real *Passive = NULL;   // EOS_GAMMA does not involve passive scalars
-#  endif
-#  else
+#  if ( EOS != EOS_GAMMA )
 #  error : Hydro_Pri2Char() only supports EOS_GAMMA !!
 #  endif
 
@@ -1296,8 +1504,8 @@ void Hydro_Pri2Char( real InOut[], const real Dens, const real Pres, const real
 
 // b. pure hydro
 #  else // #ifdef MHD
-   const real  a2 = EoS->DensPres2CSqr_FuncPtr( Dens, Pres, Passive, EoS->AuxArrayDevPtr_Flt,
-                                                EoS->AuxArrayDevPtr_Int, EoS->Table );
+   const real  a2 = EOS_DENSPRES2CSQR( EoS->DensPres2CSqr_FuncPtr, Dens, Pres, NULL, EoS->AuxArrayDevPtr_Flt,
+                                       EoS->AuxArrayDevPtr_Int, EoS->Table );
    const real _a2 = (real)1.0 / a2;
    const real _a  = SQRT( _a2 );
 
@@ -1337,9 +1545,7 @@ void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, const real
 {
 
 // check
-#  if ( EOS == EOS_GAMMA )
-   const real *Passive = NULL;   // EOS_GAMMA does not involve passive scalars
-#  else
+#  if ( EOS != EOS_GAMMA )
 #  error : Hydro_Char2Pri() only supports EOS_GAMMA !!
 #  endif
 
@@ -1362,8 +1568,8 @@ void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, const real
 
 
 // primitive --> characteristic
-   const real a2 = EoS->DensPres2CSqr_FuncPtr( Dens, Pres, Passive, EoS->AuxArrayDevPtr_Flt,
-                                               EoS->AuxArrayDevPtr_Int, EoS->Table );
+   const real a2 = EOS_DENSPRES2CSQR( EoS->DensPres2CSqr_FuncPtr, Dens, Pres, NULL, EoS->AuxArrayDevPtr_Flt,
+                                      EoS->AuxArrayDevPtr_Int, EoS->Table );
 
 // a. MHD
 #  ifdef MHD
@@ -1440,9 +1646,7 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 #endif
 {
 
-#  if ( EOS == EOS_GAMMA )
-   const real *Passive = NULL;   // EOS_GAMMA does not involve passive scalars
-#  else
+#  if ( EOS != EOS_GAMMA )
 #  error : Hydro/MHD_GetEigenSystem() only supports EOS_GAMMA !!
 #  endif
 
@@ -1454,8 +1658,8 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 
    const real  Rho = CC_Var[0];
    const real _Rho = (real)1.0/Rho;
-   const real  a2  = EoS->DensPres2CSqr_FuncPtr( Rho, CC_Var[4], Passive, EoS->AuxArrayDevPtr_Flt,
-                                                 EoS->AuxArrayDevPtr_Int, EoS->Table );
+   const real  a2  = EOS_DENSPRES2CSQR( EoS->DensPres2CSqr_FuncPtr, Rho, CC_Var[4], NULL, EoS->AuxArrayDevPtr_Flt,
+                                        EoS->AuxArrayDevPtr_Int, EoS->Table );
    const real  a   = SQRT( a2 );
    const real _a   = (real)1.0/a;
    const real _a2  = _a*_a;
@@ -1716,6 +1920,7 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 
 
 
+#ifndef LR_PENCIL
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_LimitSlope
 // Description :  Evaluate the monotonic slope by slope limiters
@@ -1852,6 +2057,209 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
 #  endif
 
 } // FUNCTION : Hydro_LimitSlope
+#endif // #ifndef LR_PENCIL
+
+
+
+#ifdef LR_PENCIL
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_LimitSlope_Pencil
+// Description :  Evaluate the monotonic slope of a row of cells by slope limiters
+//
+// Note        :  1. Pencil version of Hydro_LimitSlope() used by LR_PENCIL
+//                   --> Return exactly the same results but process N cells of one variable at a time
+//                       so that the loops can be vectorized
+//                   --> Do not support CHAR_RECONSTRUCTION
+//                2. Input data must be primitive variables
+//                3. FMIN() is replaced by the ternary operator since all its arguments are non-negative here
+//                4. Denominators are set to one for the cells with non-positive Slope_L*Slope_R to avoid
+//                   dividing by zero in the discarded results
+//
+// Parameter   :  L             : Array storing the elements x-1
+//                C             : Array storing the elements x
+//                R             : Array storing the elements x+1
+//                N             : Number of cells in the row
+//                LR_Limiter    : Slope limiter for the data reconstruction in the MHM/MHM_RP schemes
+//                MinMod_Coeff  : Coefficient of the generalized MinMod limiter
+//                Slope_Limiter : Array to store the output monotonic slope
+//-------------------------------------------------------------------------------------------------------
+void Hydro_LimitSlope_Pencil( const real L[], const real C[], const real R[], const int N,
+                              const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, real Slope_Limiter[] )
+{
+
+   switch ( LR_Limiter )
+   {
+      case LR_LIMITER_CENTRAL:      // central
+#        pragma omp simd
+         for (int i=0; i<N; i++)
+         {
+            const real Slope_L  = C[i] - L[i];
+            const real Slope_R  = R[i] - C[i];
+            const real Slope_C  = (real)0.5*( Slope_L + Slope_R );
+            const real Slope_LR = Slope_L*Slope_R;
+
+            Slope_Limiter[i] = ( Slope_LR > (real)0.0 ) ? Slope_C : (real)0.0;
+         }
+         break;
+
+      case LR_LIMITER_VANLEER:      // van-Leer
+#        pragma omp simd
+         for (int i=0; i<N; i++)
+         {
+            const real Slope_L  = C[i] - L[i];
+            const real Slope_R  = R[i] - C[i];
+            const real Slope_LR = Slope_L*Slope_R;
+            const bool Mono     = ( Slope_LR > (real)0.0 );
+            const real Deno     = ( Mono ) ? Slope_L + Slope_R : (real)1.0;
+
+            Slope_Limiter[i] = ( Mono ) ? (real)2.0*Slope_LR/Deno : (real)0.0;
+         }
+         break;
+
+      case LR_LIMITER_GMINMOD:      // generalized MinMod
+#        pragma omp simd
+         for (int i=0; i<N; i++)
+         {
+            const real Slope_L  = C[i] - L[i];
+            const real Slope_R  = R[i] - C[i];
+            const real Slope_C  = (real)0.5*( Slope_L + Slope_R );
+            const real Slope_LR = Slope_L*Slope_R;
+            const real Abs_L    = FABS( Slope_L*MinMod_Coeff );
+            const real Abs_R    = FABS( Slope_R*MinMod_Coeff );
+            const real Abs_C    = FABS( Slope_C );
+            real Slope;
+
+            Slope  = ( Abs_L < Abs_R ) ? Abs_L : Abs_R;
+            Slope  = ( Abs_C < Slope ) ? Abs_C : Slope;
+            Slope *= SIGN( Slope_C );
+
+            Slope_Limiter[i] = ( Slope_LR > (real)0.0 ) ? Slope : (real)0.0;
+         }
+         break;
+
+      case LR_LIMITER_ALBADA:       // van-Albada
+#        pragma omp simd
+         for (int i=0; i<N; i++)
+         {
+            const real Slope_L  = C[i] - L[i];
+            const real Slope_R  = R[i] - C[i];
+            const real Slope_LR = Slope_L*Slope_R;
+            const bool Mono     = ( Slope_LR > (real)0.0 );
+            const real Deno     = ( Mono ) ? Slope_L*Slope_L + Slope_R*Slope_R : (real)1.0;
+
+            Slope_Limiter[i] = ( Mono ) ? Slope_LR*( Slope_L + Slope_R )/Deno : (real)0.0;
+         }
+         break;
+
+      case LR_LIMITER_VL_GMINMOD:   // van-Leer + generalized MinMod
+#        pragma omp simd
+         for (int i=0; i<N; i++)
+         {
+            const real Slope_L  = C[i] - L[i];
+            const real Slope_R  = R[i] - C[i];
+            const real Slope_C  = (real)0.5*( Slope_L + Slope_R );
+            const real Slope_LR = Slope_L*Slope_R;
+            const bool Mono     = ( Slope_LR > (real)0.0 );
+            const real Deno     = ( Mono ) ? Slope_L + Slope_R : (real)1.0;
+            const real Slope_A  = ( Mono ) ? (real)2.0*Slope_L*Slope_R/Deno : (real)0.0;
+            const real Abs_L    = FABS( Slope_L*MinMod_Coeff );
+            const real Abs_R    = FABS( Slope_R*MinMod_Coeff );
+            const real Abs_C    = FABS( Slope_C );
+            const real Abs_A    = FABS( Slope_A );
+            real Slope;
+
+            Slope  = ( Abs_L < Abs_R ) ? Abs_L : Abs_R;
+            Slope  = ( Abs_C < Slope ) ? Abs_C : Slope;
+            Slope  = ( Abs_A < Slope ) ? Abs_A : Slope;
+            Slope *= SIGN( Slope_C );
+
+            Slope_Limiter[i] = ( Mono ) ? Slope : (real)0.0;
+         }
+         break;
+
+      default :
+#        ifdef GAMER_DEBUG
+         printf( "ERROR : incorrect parameter %s = %d !!\n", "LR_Limiter", LR_Limiter );
+#        endif
+         return;
+   } // switch ( LR_Limiter )
+
+} // FUNCTION : Hydro_LimitSlope_Pencil
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_FC_Pri2Con
+// Description :  Convert the face-centered primitive variables stored in g_FC_Var[] to conserved variables
+//                and advance them by half time-step for the MHM integrator
+//
+// Note        :  1. Used by LR_PENCIL, which stores the reconstructed primitive variables in g_FC_Var[] directly
+//                2. Same as the last steps of the cell-by-cell Hydro_DataReconstruction()
+//                3. Input and output arrays are the same
+//                4. g_ConVar, NIn, NGhost, dt, dh, and MinDens/Pres/Eint are only used by the half-step
+//                   prediction of MHM and are ignored for MHM_RP
+//
+// Parameter   :  g_ConVar          : Array storing the input cell-centered conserved variables (for MHM only)
+//                g_FC_Var          : Array storing the face-centered primitive variables
+//                                    --> Will be overwritten by the conserved variables
+//                NIn               : Size of g_ConVar[] along each direction
+//                NGhost            : Number of ghost zones
+//                k_fc_s/e          : Range of the z-slabs in g_FC_Var[] to be converted
+//                dt                : Time interval to advance solution (for MHM only)
+//                dh                : Cell size (for MHM only)
+//                MinDens/Pres/Eint : Density, pressure, and internal energy floors
+//                FracPassive       : true --> convert passive scalars to mass fraction during data reconstruction
+//                NFrac             : Number of passive scalars for the option "FracPassive"
+//                FracIdx           : Target variable indices for the option "FracPassive"
+//                EoS               : EoS object
+//-------------------------------------------------------------------------------------------------------
+void Hydro_FC_Pri2Con( const real g_ConVar[][ CUBE(FLU_NXT) ],
+                             real g_FC_Var[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                       const int NIn, const int NGhost, const int k_fc_s, const int k_fc_e,
+                       const real dt, const real dh,
+                       const real MinDens, const real MinPres, const real MinEint,
+                       const bool FracPassive, const int NFrac, const int FracIdx[],
+                       const EoS_t *EoS )
+{
+
+#  if ( FLU_SCHEME != MHM )
+   (void)g_ConVar;  (void)NIn;  (void)NGhost;  (void)dt;  (void)dh;   // see Note 4
+   (void)MinDens;  (void)MinPres;  (void)MinEint;
+#  endif
+
+   const int N_FC_VAR2 = SQR( N_FC_VAR );
+
+   CGPU_LOOP( t, N_FC_VAR2*(k_fc_e-k_fc_s) )
+   {
+      const int idx_fc = N_FC_VAR2*k_fc_s + t;
+
+      real fc[6][NCOMP_LR], tmp[NCOMP_LR];   // input and output arrays must not overlap for Pri2Con()
+
+      for (int f=0; f<6; f++)
+      {
+         for (int v=0; v<NCOMP_LR; v++)   tmp[v] = g_FC_Var[f][v][idx_fc];
+
+         Hydro_Pri2Con( tmp, fc[f], FracPassive, NFrac, FracIdx, EoS->DensPres2Eint_FuncPtr,
+                        EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table, NULL );
+      }
+
+#     if ( FLU_SCHEME == MHM )
+      const int i_cc   = NGhost + idx_fc%N_FC_VAR;
+      const int j_cc   = NGhost + idx_fc%N_FC_VAR2/N_FC_VAR;
+      const int k_cc   = NGhost + idx_fc/N_FC_VAR2;
+      const int idx_cc = IDX321( i_cc, j_cc, k_cc, NIn, NIn );
+
+      Hydro_HancockPredict( fc, dt, dh, g_ConVar, idx_cc, MinDens, MinPres, MinEint, EoS );
+#     endif
+
+      for (int f=0; f<6; f++)
+      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         g_FC_Var[f][v][idx_fc] = fc[f][v];
+
+   } // CGPU_LOOP( t, N_FC_VAR2*(k_fc_e-k_fc_s) )
+
+} // FUNCTION : Hydro_FC_Pri2Con
+#endif // #ifdef LR_PENCIL
 
 
 
@@ -33,6 +33,9 @@
 //                2. Invoke dual-energy check if DualEnergySwitch is on
 //                3. If any unphysical fluid cell is found in a patch group, Hydro_FullStepUpdate() will
 //                   return instantly unless Iteration==MinMod_MaxIter
+//                4. Only the z-slabs k_out_s <= k < k_out_e of g_Output[] are updated
+//                   --> Set k_out_s=0 and k_out_e=PS2 to update the entire patch group
+//                   --> Used by FLU_TILE in CUFLU.h
 //
 // Parameter   :  g_Input           : Array storing the input fluid data
 //                g_Output          : Array to store the updated fluid data
@@ -58,13 +61,15 @@
 //                                    --> s_FullStepFailure can be NULL, for which both Iteration and MinMod_MaxIter become useless
 //                Iteration         : Current iteration number (should be <= MinMod_MaxIter)
 //                MinMod_MaxIter    : Maximum number of iterations to reduce the min-mod coefficient (i.e., MINMOD_MAX_ITER)
+//                k_out_s/e         : Range of the z-slabs in g_Output[] to be updated (see Note 4)
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real MinDens, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const EoS_t *EoS, int *s_FullStepFailure, const int Iteration, const int MinMod_MaxIter )
+                           const EoS_t *EoS, int *s_FullStepFailure, const int Iteration, const int MinMod_MaxIter,
+                           const int k_out_s, const int k_out_e )
 {
 
    const int  didx_flux[3]    = { 1, N_FL_FLUX, SQR(N_FL_FLUX) };
@@ -75,8 +80,9 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 
 
    const int size_ij = SQR(PS2);
-   CGPU_LOOP( idx_out, CUBE(PS2) )
+   CGPU_LOOP( t, size_ij*(k_out_e-k_out_s) )
    {
+      const int idx_out  = size_ij*k_out_s + t;
       const int i_out    = idx_out % PS2;
       const int j_out    = idx_out % size_ij / PS2;
       const int k_out    = idx_out / size_ij;
@@ -216,7 +222,7 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
          }
 #        endif
       } // if ( s_FullStepFailure != NULL )
-   } // CGPU_LOOP( idx_out, CUBE(PS2) )
+   } // CGPU_LOOP( t, size_ij*(k_out_e-k_out_s) )
 
 
 // 6. synchronize s_FullStepFailure for all threads within a GPU thread block
@@ -93,8 +93,8 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
                            EoS_DensEint2Pres, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table, NULL );
    P_R   = Hydro_Con2Pres( R[0], R[1], R[2], R[3], R[4], R+NCOMP_FLUID, CheckMinPres_Yes, MinPres, Emag,
                            EoS_DensEint2Pres, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table, NULL );
-   Cs_L  = SQRT(  EoS_DensPres2CSqr( L[0], P_L, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )  );
-   Cs_R  = SQRT(  EoS_DensPres2CSqr( R[0], P_R, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )  );
+   Cs_L  = SQRT(  EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, L[0], P_L, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )  );
+   Cs_R  = SQRT(  EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, R[0], P_R, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )  );
 
 #  ifdef CHECK_UNPHYSICAL_IN_FLUID
    Hydro_CheckUnphysical( UNPHY_MODE_SING, &P_R, "pressure", ERROR_INFO, UNPHY_VERBOSE );
@@ -185,8 +185,8 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
    Rho_SR      = FMAX( Rho_SR, MinDens );
    _P          = ONE / P_PVRS;
 // see Eq. [9.8] in Toro 1999 for passive scalars
-   Gamma_SL    = EoS_DensPres2CSqr( Rho_SL, P_PVRS, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SL*_P;
-   Gamma_SR    = EoS_DensPres2CSqr( Rho_SR, P_PVRS, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SR*_P;
+   Gamma_SL    = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Rho_SL, P_PVRS, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SL*_P;
+   Gamma_SR    = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Rho_SR, P_PVRS, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SR*_P;
 #  endif // EOS
 
    q_L = ( P_PVRS <= P_L ) ? ONE : SQRT(  ONE + _TWO*( Gamma_SL + ONE )/Gamma_SL*( P_PVRS/P_L - ONE )  );
@@ -312,6 +312,147 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
 
 
 
+#if ( defined RSOLVER_ROW  &&  RSOLVER == HLLC )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLC_Row
+// Description :  Batched version of Hydro_RiemannSolver_HLLC() solving the Riemann problems of a row of
+//                interfaces at once
+//
+// Note        :  1. CPU only and only for EOS_GAMMA + HLL_WAVESPEED_DAVIS in pure hydro (see RSOLVER_ROW in CUFLU.h)
+//                2. Input and output data are stored in the SoA form [NCOMP_TOTAL][N_RSOLVER_ROW]
+//                   --> Only the first NFace elements are computed
+//                3. Same operations as Hydro_RiemannSolver_HLLC() but written branch-free so that the loop
+//                   over interfaces can be vectorized
+//                   --> The results are identical to those of Hydro_RiemannSolver_HLLC() as long as the
+//                       input data are not NaN
+//                4. Invoked by Hydro_ComputeFlux()
+//
+// Parameter   :  XYZ              : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NFace            : Number of interfaces to be computed (<= N_RSOLVER_ROW)
+//                Flux_Out         : Array to store the output fluxes
+//                L/R_In           : Input left/right states (conserved variables)
+//                MinPres          : Pressure floor
+//                EoS_AuxArray_Flt : Auxiliary array for the EoS routines
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLC_Row( const int XYZ, const int NFace, real Flux_Out[][N_RSOLVER_ROW],
+                                   const real L_In[][N_RSOLVER_ROW], const real R_In[][N_RSOLVER_ROW],
+                                   const real MinPres, const double EoS_AuxArray_Flt[] )
+{
+
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real Gamma    = (real)EoS_AuxArray_Flt[0];
+   const real Gamma_m1 = (real)EoS_AuxArray_Flt[1];
+
+// indices of the normal and transverse momenta
+   const int  MomN     = 1 + XYZ;
+   const int  MomT1    = 1 + (XYZ+1)%3;
+   const int  MomT2    = 1 + (XYZ+2)%3;
+
+   const real *L_Dens = L_In[0], *L_MomN = L_In[MomN], *L_MomT1 = L_In[MomT1], *L_MomT2 = L_In[MomT2], *L_Engy = L_In[4];
+   const real *R_Dens = R_In[0], *R_MomN = R_In[MomN], *R_MomT1 = R_In[MomT1], *R_MomT2 = R_In[MomT2], *R_Engy = R_In[4];
+
+
+#  pragma omp simd
+   for (int t=0; t<NFace; t++)
+   {
+//    1. compute the left/right states
+      const real _RhoL = ONE / L_Dens[t];
+      const real _RhoR = ONE / R_Dens[t];
+      const real u_L   = _RhoL*L_MomN[t];
+      const real u_R   = _RhoR*R_MomN[t];
+
+      real P_L, P_R;
+      P_L = (  L_Engy[t] - (real)0.5*( SQR(L_MomN[t]) + SQR(L_MomT1[t]) + SQR(L_MomT2[t]) ) / L_Dens[t]  )*Gamma_m1;
+      P_R = (  R_Engy[t] - (real)0.5*( SQR(R_MomN[t]) + SQR(R_MomT1[t]) + SQR(R_MomT2[t]) ) / R_Dens[t]  )*Gamma_m1;
+      P_L = ( P_L == P_L  &&  P_L < MinPres ) ? MinPres : P_L;
+      P_R = ( P_R == P_R  &&  P_R < MinPres ) ? MinPres : P_R;
+
+      const real Cs_L = SQRT( Gamma*P_L/L_Dens[t] );
+      const real Cs_R = SQRT( Gamma*P_R/R_Dens[t] );
+
+
+//    2. estimate the maximum wave speeds by HLL_WAVESPEED_DAVIS
+      const real W_L1 = u_L - Cs_L;
+      const real W_L2 = u_R - Cs_R;
+      const real W_R1 = u_L + Cs_L;
+      const real W_R2 = u_R + Cs_R;
+      const real W_L  = ( W_L2 < W_L1 ) ? W_L2 : W_L1;
+      const real W_R  = ( W_R2 > W_R1 ) ? W_R2 : W_R1;
+
+
+//    3. evaluate the star-region velocity (V_S) and pressure (P_S)
+      const real temp1_L = +L_Dens[t]*(  ( W_L1 < W_L2 ) ? Cs_L : (u_L-u_R)+Cs_R  );
+      const real temp1_R = -R_Dens[t]*(  ( W_R2 > W_R1 ) ? Cs_R : (u_L-u_R)+Cs_L  );
+      const real temp2   = ONE / ( temp1_L - temp1_R );
+      const real V_S     = temp2*( P_L - P_R + temp1_L*u_L - temp1_R*u_R );
+      real       P_S     = temp2*(  temp1_L*( P_R + temp1_R*u_R ) - temp1_R*( P_L + temp1_L*u_L )  );
+      P_S = ( P_S == P_S  &&  P_S < MinPres ) ? MinPres : P_S;
+
+
+//    4. evaluate the weightings of the upwind flux and contact wave
+//    --> compute both candidates and select afterward to keep the loop branch-free
+      const bool UseL     = ( V_S >= ZERO );
+      const real Dens_Up  = ( UseL ) ? L_Dens [t] : R_Dens [t];
+      const real MomN_Up  = ( UseL ) ? L_MomN [t] : R_MomN [t];
+      const real MomT1_Up = ( UseL ) ? L_MomT1[t] : R_MomT1[t];
+      const real MomT2_Up = ( UseL ) ? L_MomT2[t] : R_MomT2[t];
+      const real Engy_Up  = ( UseL ) ? L_Engy [t] : R_Engy [t];
+      const real Pres_Up  = ( UseL ) ? P_L        : P_R;
+      const real MaxV     = ( UseL ) ? ( (W_L < ZERO) ? W_L : ZERO )
+                                     : ( (W_R > ZERO) ? W_R : ZERO );
+
+//    deal with the special case of V_S=MaxV_L=0
+      const bool Special  = ( UseL  &&  V_S == ZERO  &&  MaxV == ZERO );
+      const real temp4    = ONE / ( V_S - MaxV );
+      const real Coeff_LR = ( Special ) ? ONE  :  temp4*V_S;
+      const real Coeff_S  = ( Special ) ? ZERO : -temp4*MaxV*P_S;
+
+
+//    5. evaluate the HLLC fluxes
+//    --> same operations as Hydro_Con2Flux() along the maximum wave speed
+      const real Vx = ( ONE / Dens_Up )*MomN_Up;
+      const real F0 = Coeff_LR*(  MomN_Up                       - MaxV*Dens_Up  );
+      const real F1 = Coeff_LR*(  Vx*MomN_Up + Pres_Up          - MaxV*MomN_Up  ) + Coeff_S;
+      const real F2 = Coeff_LR*(  Vx*MomT1_Up                   - MaxV*MomT1_Up );
+      const real F3 = Coeff_LR*(  Vx*MomT2_Up                   - MaxV*MomT2_Up );
+      const real F4 = Coeff_LR*(  Vx*( Engy_Up + Pres_Up )      - MaxV*Engy_Up  ) + Coeff_S*V_S;
+
+//    restore the correct order
+      Flux_Out[0    ][t] = F0;
+      Flux_Out[MomN ][t] = F1;
+      Flux_Out[MomT1][t] = F2;
+      Flux_Out[MomT2][t] = F3;
+      Flux_Out[4    ][t] = F4;
+   } // for (int t=0; t<NFace; t++)
+
+
+// 6. evaluate the fluxes of passive scalars
+// --> use a separate loop since the conditional loads of the upwind passive scalars would prevent
+//     the loop above from being vectorized
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int t=0; t<NFace; t++)
+   {
+      const real Flux_Dens = Flux_Out[FLUX_DENS][t];
+
+      if ( Flux_Dens >= ZERO )
+      {
+         const real vx = Flux_Dens*( ONE / L_Dens[t] );
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Flux_Out[v][t] = L_In[v][t]*vx;
+      }
+      else
+      {
+         const real vx = Flux_Dens*( ONE / R_Dens[t] );
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Flux_Out[v][t] = R_In[v][t]*vx;
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLC_Row
+#endif // #if ( defined RSOLVER_ROW  &&  RSOLVER == HLLC )
+
+
+
 #endif // #if ( MODEL == HYDRO )
 
 
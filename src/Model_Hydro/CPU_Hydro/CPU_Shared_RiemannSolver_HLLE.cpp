@@ -118,8 +118,8 @@ void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[]
                            EoS_DensEint2Pres, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table, NULL );
    P_R   = Hydro_Con2Pres( R[0], R[1], R[2], R[3], R[4], R+NCOMP_FLUID, CheckMinPres_Yes, MinPres, Emag_R,
                            EoS_DensEint2Pres, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table, NULL );
-   a2_L  = EoS_DensPres2CSqr( L[0], P_L, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
-   a2_R  = EoS_DensPres2CSqr( R[0], P_R, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   a2_L  = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, L[0], P_L, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
+   a2_R  = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, R[0], P_R, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table );
 
 #  ifdef CHECK_UNPHYSICAL_IN_FLUID
    Hydro_CheckUnphysical( UNPHY_MODE_SING, &P_L, "pressure", ERROR_INFO, UNPHY_VERBOSE );
@@ -349,8 +349,8 @@ void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[]
    Rho_SR      = FMAX( Rho_SR, MinDens );
    _P          = ONE / P_PVRS;
 // see Eq. [9.8] in Toro 1999 for passive scalars
-   Gamma_SL    = EoS_DensPres2CSqr( Rho_SL, P_PVRS, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SL*_P;
-   Gamma_SR    = EoS_DensPres2CSqr( Rho_SR, P_PVRS, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SR*_P;
+   Gamma_SL    = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Rho_SL, P_PVRS, L+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SL*_P;
+   Gamma_SR    = EOS_DENSPRES2CSQR( EoS_DensPres2CSqr, Rho_SR, P_PVRS, R+NCOMP_FLUID, EoS_AuxArray_Flt, EoS_AuxArray_Int, EoS_Table )*Rho_SR*_P;
 #  endif // EOS
 
    q_L    = ( P_PVRS <= P_L ) ? ONE : SQRT(  ONE + _TWO*( Gamma_SL + ONE )/Gamma_SL*( P_PVRS/P_L - ONE )  );
@@ -445,6 +445,135 @@ void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[]
 
 
 
+#if ( defined RSOLVER_ROW  &&  RSOLVER == HLLE )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLE_Row
+// Description :  Batched version of Hydro_RiemannSolver_HLLE() solving the Riemann problems of a row of
+//                interfaces at once
+//
+// Note        :  1. CPU only and only for EOS_GAMMA + HLL_WAVESPEED_DAVIS in pure hydro (see RSOLVER_ROW in CUFLU.h)
+//                2. Input and output data are stored in the SoA form [NCOMP_TOTAL][N_RSOLVER_ROW]
+//                   --> Only the first NFace elements are computed
+//                3. Same operations as Hydro_RiemannSolver_HLLE() but written branch-free so that the loop
+//                   over interfaces can be vectorized
+//                   --> The results are identical to those of Hydro_RiemannSolver_HLLE() as long as the
+//                       input data are not NaN
+//                4. Invoked by Hydro_ComputeFlux()
+//
+// Parameter   :  XYZ              : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NFace            : Number of interfaces to be computed (<= N_RSOLVER_ROW)
+//                Flux_Out         : Array to store the output fluxes
+//                L/R_In           : Input left/right states (conserved variables)
+//                MinPres          : Pressure floor
+//                EoS_AuxArray_Flt : Auxiliary array for the EoS routines
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLE_Row( const int XYZ, const int NFace, real Flux_Out[][N_RSOLVER_ROW],
+                                   const real L_In[][N_RSOLVER_ROW], const real R_In[][N_RSOLVER_ROW],
+                                   const real MinPres, const double EoS_AuxArray_Flt[] )
+{
+
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real Gamma    = (real)EoS_AuxArray_Flt[0];
+   const real Gamma_m1 = (real)EoS_AuxArray_Flt[1];
+
+// indices of the normal and transverse momenta
+   const int  MomN     = 1 + XYZ;
+   const int  MomT1    = 1 + (XYZ+1)%3;
+   const int  MomT2    = 1 + (XYZ+2)%3;
+
+   const real *L_Dens = L_In[0], *L_MomN = L_In[MomN], *L_MomT1 = L_In[MomT1], *L_MomT2 = L_In[MomT2], *L_Engy = L_In[4];
+   const real *R_Dens = R_In[0], *R_MomN = R_In[MomN], *R_MomT1 = R_In[MomT1], *R_MomT2 = R_In[MomT2], *R_Engy = R_In[4];
+
+
+#  pragma omp simd
+   for (int t=0; t<NFace; t++)
+   {
+//    1. compute the left/right states
+      const real _RhoL = ONE / L_Dens[t];
+      const real _RhoR = ONE / R_Dens[t];
+      const real u_L   = _RhoL*L_MomN[t];
+      const real u_R   = _RhoR*R_MomN[t];
+
+      real P_L, P_R;
+      P_L = (  L_Engy[t] - (real)0.5*( SQR(L_MomN[t]) + SQR(L_MomT1[t]) + SQR(L_MomT2[t]) ) / L_Dens[t]  )*Gamma_m1;
+      P_R = (  R_Engy[t] - (real)0.5*( SQR(R_MomN[t]) + SQR(R_MomT1[t]) + SQR(R_MomT2[t]) ) / R_Dens[t]  )*Gamma_m1;
+      P_L = ( P_L == P_L  &&  P_L < MinPres ) ? MinPres : P_L;
+      P_R = ( P_R == P_R  &&  P_R < MinPres ) ? MinPres : P_R;
+
+      const real Cf_L = SQRT( Gamma*P_L/L_Dens[t] );
+      const real Cf_R = SQRT( Gamma*P_R/R_Dens[t] );
+
+
+//    2. estimate the maximum wave speeds by HLL_WAVESPEED_DAVIS
+      const real W_L1 = u_L - Cf_L;
+      const real W_L2 = u_R - Cf_R;
+      const real W_R1 = u_L + Cf_L;
+      const real W_R2 = u_R + Cf_R;
+
+      real MaxV_L, MaxV_R;
+      MaxV_L = ( W_L2 < W_L1 ) ? W_L2 : W_L1;
+      MaxV_R = ( W_R2 > W_R1 ) ? W_R2 : W_R1;
+      MaxV_L = ( MaxV_L < ZERO ) ? MaxV_L : ZERO;
+      MaxV_R = ( MaxV_R > ZERO ) ? MaxV_R : ZERO;
+
+
+//    3. evaluate the left and right fluxes along the maximum wave speeds
+//    --> same operations as Hydro_Con2Flux()
+      const real FL_Dens  = L_MomN[t]                - MaxV_L*L_Dens [t];
+      const real FL_MomN  = u_L*L_MomN [t] + P_L     - MaxV_L*L_MomN [t];
+      const real FL_MomT1 = u_L*L_MomT1[t]           - MaxV_L*L_MomT1[t];
+      const real FL_MomT2 = u_L*L_MomT2[t]           - MaxV_L*L_MomT2[t];
+      const real FL_Engy  = u_L*( L_Engy[t] + P_L )  - MaxV_L*L_Engy [t];
+
+      const real FR_Dens  = R_MomN[t]                - MaxV_R*R_Dens [t];
+      const real FR_MomN  = u_R*R_MomN [t] + P_R     - MaxV_R*R_MomN [t];
+      const real FR_MomT1 = u_R*R_MomT1[t]           - MaxV_R*R_MomT1[t];
+      const real FR_MomT2 = u_R*R_MomT2[t]           - MaxV_R*R_MomT2[t];
+      const real FR_Engy  = u_R*( R_Engy[t] + P_R )  - MaxV_R*R_Engy [t];
+
+
+//    4. evaluate the HLLE fluxes and restore the correct order
+//    --> deal with the special case of MaxV_L=MaxV_R=0
+//    --> since MaxV_L<=0 and MaxV_R>=0, it is equivalent to MaxV_R-MaxV_L=0, which vectorizes better
+      const real MaxV_R_minus_L  = MaxV_R - MaxV_L;
+      const bool Special         = ( MaxV_R_minus_L == ZERO );
+      const real _MaxV_R_minus_L = ONE / MaxV_R_minus_L;
+
+      Flux_Out[0    ][t] = ( Special ) ? FL_Dens  : _MaxV_R_minus_L*( MaxV_R*FL_Dens  - MaxV_L*FR_Dens  );
+      Flux_Out[MomN ][t] = ( Special ) ? FL_MomN  : _MaxV_R_minus_L*( MaxV_R*FL_MomN  - MaxV_L*FR_MomN  );
+      Flux_Out[MomT1][t] = ( Special ) ? FL_MomT1 : _MaxV_R_minus_L*( MaxV_R*FL_MomT1 - MaxV_L*FR_MomT1 );
+      Flux_Out[MomT2][t] = ( Special ) ? FL_MomT2 : _MaxV_R_minus_L*( MaxV_R*FL_MomT2 - MaxV_L*FR_MomT2 );
+      Flux_Out[4    ][t] = ( Special ) ? FL_Engy  : _MaxV_R_minus_L*( MaxV_R*FL_Engy  - MaxV_L*FR_Engy  );
+   } // for (int t=0; t<NFace; t++)
+
+
+// 5. evaluate the fluxes of passive scalars
+// --> use a separate loop since the conditional loads of the upwind passive scalars would prevent
+//     the loop above from being vectorized
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int t=0; t<NFace; t++)
+   {
+      const real Flux_Dens = Flux_Out[FLUX_DENS][t];
+
+      if ( Flux_Dens >= ZERO )
+      {
+         const real vx = Flux_Dens*( ONE / L_Dens[t] );
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Flux_Out[v][t] = L_In[v][t]*vx;
+      }
+      else
+      {
+         const real vx = Flux_Dens*( ONE / R_Dens[t] );
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Flux_Out[v][t] = R_In[v][t]*vx;
+      }
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_HLLE_Row
+#endif // #if ( defined RSOLVER_ROW  &&  RSOLVER == HLLE )
+
+
+
 #endif // #if ( MODEL == HYDRO )
 
 
@@ -251,6 +251,11 @@ void Output_DumpData( const int Stage )
 //    before dumpting data --> for bitwise reproducibility
       if ( OPT__CORR_AFTER_ALL_SYNC == CORR_AFTER_SYNC_BEFORE_DUMP  &&  Stage != 0 )  Flu_CorrAfterAllSync();
 
+//    make sure the cached cooling time is consistent with the fluid data to be dumped
+#     if ( MODEL == HYDRO )
+      for (int lv=0; lv<NLEVEL; lv++)  Src_UpdateTCool_ExactCooling( lv );
+#     endif
+
 //    perform user-specified work before dumping data
       if ( Output_UserWorkBeforeOutput_Ptr != NULL )  Output_UserWorkBeforeOutput_Ptr();
 
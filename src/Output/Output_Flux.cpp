@@ -19,8 +19,8 @@ void Output_Flux( const int lv, const int PID, const int Sib, const char *commen
    if ( lv < 0  ||  lv >= NLEVEL )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
 
-   if ( PID < 0  ||  PID >= MAX_PATCH )
-      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (MAX_PATCH = %d) !!\n", "PID", PID, MAX_PATCH );
+   if ( PID < 0  ||  PID >= amr->patch[0][lv].Size() )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (patch table size = %d) !!\n", "PID", PID, amr->patch[0][lv].Size() );
 
    if ( !amr->WithFlux )
       Aux_Message( stderr, "WARNING : invoking %s is useless since no flux is required !!\n", __FUNCTION__ );
@@ -27,8 +27,8 @@ void Output_Patch( const int lv, const int PID, const int FluSg, const int MagSg
    if ( lv < 0  ||  lv >= NLEVEL )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
 
-   if ( PID < 0  ||  PID >= MAX_PATCH )
-      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (MAX_PATCH = %d) !!\n", "PID", PID, MAX_PATCH );
+   if ( PID < 0  ||  PID >= amr->patch[0][lv].Size() )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (patch table size = %d) !!\n", "PID", PID, amr->patch[0][lv].Size() );
 
    if ( FluSg < 0  ||  FluSg >= 2 )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "FluSg", FluSg );
@@ -18,23 +18,25 @@ extern bool (*Flag_User_Ptr)( const int i, const int j, const int k, const int l
 //                2. For OPT__FLAG_USER, the function pointer "Flag_User_Ptr" must be set by a
 //                   test problem initializer
 //
-// Parameter   :  lv           : Target refinement level
-//                PID          : Target patch ID
-//                i,j,k        : Indices of the target cell
-//                dv           : Cell volume at the target level
-//                Fluid        : Input fluid array (with NCOMP_TOTAL components)
-//                Pot          : Input potential array
-//                MagCC        : Input cell-centered B field array
-//                Vel          : Input velocity array
-//                Pres         : Input pressure array
-//                Lohner_Ave   : Input array storing the averages for the Lohner error estimator
-//                Lohner_Slope : Input array storing the slopes for the Lohner error estimator
-//                Lohner_NVar  : Number of variables stored in Lohner_Ave and Lohner_Slope
-//                ParCount     : Input array storing the number of particles on each cell
-//                               (note that it has the **real** type)
-//                ParDens      : Input array storing the particle mass density on each cell
-//                JeansCoeff   : Pi*GAMMA/(SafetyFactor^2*G), where SafetyFactor = FlagTable_Jeans[lv]
-//                               --> Flag if dh^2 > JeansCoeff*Pres/Dens^2
+// Parameter   :  lv            : Target refinement level
+//                PID           : Target patch ID
+//                i,j,k         : Indices of the target cell
+//                dv            : Cell volume at the target level
+//                Fluid         : Input fluid array (with NCOMP_TOTAL components)
+//                Pot           : Input potential array
+//                MagCC         : Input cell-centered B field array
+//                Vel           : Input velocity array
+//                Pres          : Input pressure array
+//                Lohner_Ave    : Input array storing the averages for the Lohner error estimator
+//                Lohner_Slope  : Input array storing the slopes for the Lohner error estimator
+//                Lohner_NVar   : Number of variables stored in Lohner_Ave and Lohner_Slope
+//                ParCount      : Input array storing the number of particles on each cell
+//                                (note that it has the **real** type)
+//                ParDens       : Input array storing the particle mass density on each cell
+//                JeansCoeff    : Pi*GAMMA/(SafetyFactor^2*G), where SafetyFactor = FlagTable_Jeans[lv]
+//                                --> Flag if dh^2 > JeansCoeff*Pres/Dens^2
+//                TCoolTffCoeff : 3*Pi*Threshold^2/(32*G), where Threshold = FlagTable_TCoolTff[lv]
+//                                --> Flag if tcool/tff < Threshold <--> tcool^2 < TCoolTffCoeff/Dens
 //
 // Return      :  "true"  if any  of the refinement criteria is satisfied
 //                "false" if none of the refinement criteria is satisfied
@@ -43,7 +45,8 @@ bool Flag_Check( const int lv, const int PID, const int i, const int j, const in
                  const real Fluid[][PS1][PS1][PS1], const real Pot[][PS1][PS1], const real MagCC[][PS1][PS1][PS1],
                  const real Vel[][PS1][PS1][PS1], const real Pres[][PS1][PS1],
                  const real *Lohner_Var, const real *Lohner_Ave, const real *Lohner_Slope, const int Lohner_NVar,
-                 const real ParCount[][PS1][PS1], const real ParDens[][PS1][PS1], const real JeansCoeff )
+                 const real ParCount[][PS1][PS1], const real ParDens[][PS1][PS1], const real JeansCoeff,
+                 const real TCoolTffCoeff )
 {
 
    bool Flag = false;
@@ -149,6 +152,23 @@ bool Flag_Check( const int lv, const int PID, const int i, const int j, const in
 #  endif
 
 
+// check the ratio between the cooling time and the free-fall time
+// ===========================================================================================
+#  if ( MODEL == HYDRO  &&  defined GRAVITY )
+   if ( OPT__FLAG_TCOOL_TFF )
+   {
+//    TCOOL is prepared by Src_UpdateTCool_ExactCooling() in Flag_Real()
+//    --> skip cells without cooling (i.e., tcool <= 0.0)
+      const real TCool_1Cell = Fluid[TCOOL][k][j][i];
+
+      Flag |= (  TCool_1Cell > (real)0.0  &&  SQR(TCool_1Cell) < TCoolTffCoeff/Fluid[DENS][k][j][i]  );
+      if ( Flag )    return Flag;
+   }
+#  else
+   (void)TCoolTffCoeff;   // only used with GRAVITY
+#  endif
+
+
 // check ELBDM energy density
 // ===========================================================================================
 #  if ( MODEL == ELBDM )
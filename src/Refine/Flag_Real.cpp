@@ -53,8 +53,10 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
    const IntScheme_t Lohner_IntScheme = INT_MINMOD1D;          // interpolation scheme for Lohner
 #  if ( MODEL == HYDRO  &&  defined GRAVITY )
    const real JeansCoeff              = M_PI*GAMMA/( SQR(FlagTable_Jeans[lv])*NEWTON_G ); // flag if dh^2 > JeansCoeff*Pres/Dens^2
+   const real TCoolTffCoeff           = 3.0*M_PI*SQR(FlagTable_TCoolTff[lv])/( 32.0*NEWTON_G ); // flag if tcool^2 < TCoolTffCoeff/Dens
 #  else
    const real JeansCoeff              = NULL_REAL;
+   const real TCoolTffCoeff           = NULL_REAL;
 #  endif
 #  ifndef GRAVITY
    const OptPotBC_t OPT__BC_POT       = BC_POT_NONE;
@@ -104,6 +106,12 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
    Lohner_Stride = Lohner_NVar*Lohner_NCell*Lohner_NCell*Lohner_NCell;  // stride of array for one patch
 
 
+// make sure the cached cooling time is up to date for OPT__FLAG_TCOOL_TFF
+#  if ( MODEL == HYDRO  &&  defined GRAVITY )
+   if ( OPT__FLAG_TCOOL_TFF )    Src_UpdateTCool_ExactCooling( lv );
+#  endif
+
+
 // collect particles to **real** patches at lv
 #  ifdef PARTICLE
    if ( OPT__FLAG_NPAR_CELL  ||  OPT__FLAG_PAR_MASS_CELL )
@@ -412,7 +420,7 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
 //                check if the target cell satisfies the refinement criteria (useless pointers are always == NULL)
                   if (  lv < MAX_LEVEL  &&  Flag_Check( lv, PID, i, j, k, dv, Fluid, Pot, MagCC, Vel, Pres,
                                                         Lohner_Var+LocalID*Lohner_Stride, Lohner_Ave, Lohner_Slope, Lohner_NVar,
-                                                        ParCount, ParDens, JeansCoeff )  )
+                                                        ParCount, ParDens, JeansCoeff, TCoolTffCoeff )  )
                   {
 //                   flag itself
                      amr->patch[0][lv][PID]->flag = true;
@@ -59,7 +59,6 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
    const int  FMagSg      = amr->MagSg[lv+1];      // sandglass of magnetic field  at level "lv+1"
 #  endif
 
-   int *Cr            = NULL;    // corner coordinates
    int *BufGrandTable = NULL;    // table recording the patch IDs of grandson buffer patches
    int *BufSonTable   = NULL;    // table recording the linking index of each buffer father patch to BufGrandTable
 
@@ -77,18 +76,12 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
    const int CStart_Flu[3] = { CGhost_Flu, CGhost_Flu, CGhost_Flu };
    const int CSize_Flu3[3] = { CSize_Flu, CSize_Flu, CSize_Flu };
 
-   real Flu_CData[NCOMP_TOTAL][CSize_Flu][CSize_Flu][CSize_Flu];  // coarse-grid fluid array for interpolation
-   real Flu_FData[NCOMP_TOTAL][FSize_CC ][FSize_CC ][FSize_CC ];  // fine-grid fluid array storing the interpolation result
-
 #  ifdef GRAVITY
    int NSide_Pot, CGhost_Pot;
    Int_Table( OPT__REF_POT_INT_SCHEME, NSide_Pot, CGhost_Pot );
 
    const int CSize_Pot     = PS1 + 2*CGhost_Pot;
    const int CStart_Pot[3] = { CGhost_Pot, CGhost_Pot, CGhost_Pot };
-
-   real Pot_CData[CSize_Pot][CSize_Pot][CSize_Pot];   // coarse-grid potential array for interpolation
-   real Pot_FData[FSize_CC ][FSize_CC ][FSize_CC ];   // fine-grid potential array storing the interpolation result
 #  endif
 
 #  ifdef MHD
@@ -110,18 +103,8 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
                                    { CSize_Mag_T, CSize_Mag_N, CSize_Mag_T },
                                    { CSize_Mag_T, CSize_Mag_T, CSize_Mag_N }  };
 
-   real Mag_CData[NCOMP_MAG][ CSize_Mag_N*SQR(CSize_Mag_T) ];  // coarse-grid B field array for interpolation
-   real Mag_FData[NCOMP_MAG][ PS2P1*SQR(PS2) ];                // fine-grid B field array storing the interpolation result
-
-   real *Mag_FInterface_Ptr [6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-   real *Mag_FInterface_Data[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
-   for (int s=0; s<6; s++)    Mag_FInterface_Data[s] = new real [ SQR(PS2) ];
-
    bool *JustRefined = new bool [ amr->num[lv] ];
    for (int PID=0; PID<amr->num[lv]; PID++)  JustRefined[PID] = false;
-
-// fine-grid, cell-centered B field for INT_REDUCE_MONO_COEFF
-   real (*Mag_FDataCC_IntIter)[NCOMP_MAG] = new real [ CUBE(FSize_CC) ][NCOMP_MAG];
 #  endif // #ifdef MHD
 
 
@@ -160,10 +143,10 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
       BufSonTable   = new int [NBufFa ];
 
 //    initialize the table BufSonTable as -1
-//#     pragma omp parallel for
+#     pragma omp parallel for schedule( static )
       for (int t=0; t<NBufFa; t++)  BufSonTable[t] = -1;
 
-//#     pragma omp parallel for
+#     pragma omp parallel for schedule( static )
       for (int m=0; m<NBufSon; m+=8)
       {
 //       record the grandson patch ID
@@ -185,15 +168,15 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 
 
 // b. deallocate all buffer patches at level "lv+1"
+//    --> not parallelized since pdelete() is not thread-safe
 // ------------------------------------------------------------------------------------------------
-//#  pragma omp parallel for
    for (int PID=amr->NPatchComma[lv+1][1]; PID<amr->NPatchComma[lv+1][27]; PID++)
    {
       amr->patch[0][lv+1][PID]->son = -1;
       amr->pdelete( lv+1, PID, OPT__REUSE_MEMORY );
    }
 
-//#  pragma omp parallel for
+#  pragma omp parallel for schedule( static )
    for (int PID=amr->NPatchComma[lv][1]; PID<amr->NPatchComma[lv][27]; PID++)
       amr->patch[0][lv][PID]->son = -1;
 
@@ -206,33 +189,87 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 //      --> note that we must do this BEFORE deallocating any child patch to retain high-resolution
 //          B field on the boundaries of newly allocated patches
 // ================================================================================================
-//#  pragma omp parallel for private( ??? )
+// (c1.0) collect the patches to be refined and reserve the indices of their child patches in ascending order of PID
+//        --> the PID assignment is the same as refining one patch at a time and does not depend on the number of
+//            OpenMP threads, which is required for bitwise reproducibility
+   int  NRefine    = 0;
+   int *RefineList = new int [ amr->NPatchComma[lv][1] ];
+
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    {
-      patch_t *Pedigree = amr->patch[0][lv][PID];  // fixed to Sg=0 for the patch relation
+      const patch_t *Pedigree = amr->patch[0][lv][PID];  // fixed to Sg=0 for the patch relation
 
-      if ( Pedigree->flag  &&  Pedigree->son == -1 )
-      {
-//       (c1.1) construct relation : father -> child
-         Pedigree->son = amr->num[lv+1];
+      if ( Pedigree->flag  &&  Pedigree->son == -1 )  RefineList[ NRefine ++ ] = PID;
+   }
 
+   const int NewSonPID0 = amr->Lvreserve( lv+1, 8*NRefine );
 
-//       (c1.2) allocate child patches and construct relation : child -> father
-         Cr = Pedigree->corner;
 
-         amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2]+Width, PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2],       PID, true, true, true );
-         amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2]+Width, PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2]+Width, PID, true, true, true );
-         amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2]+Width, PID, true, true, true );
+// (c1.1) construct relation : father -> child
+//        --> must be done for all patches in advance since the B field interpolation checks whether the
+//            sibling patches have just been refined
+   for (int t=0; t<NRefine; t++)
+   {
+      amr->patch[0][lv][ RefineList[t] ]->son = NewSonPID0 + 8*t;
 
-//       record the newly refined father patches
-#        ifdef MHD
-         JustRefined[PID] = true;
-#        endif
+//    record the newly refined father patches
+#     ifdef MHD
+      JustRefined[ RefineList[t] ] = true;
+#     endif
+   }
+
+
+// refine different patches in parallel
+// --> each thread only reads the coarse-grid data and writes to its own child patches
+#  pragma omp parallel
+   {
+//    thread-private arrays for spatial interpolation
+//    --> allocated on the heap once per thread since they may not fit into the stack of the OpenMP threads
+//    --> CData[] are stored as 1D arrays since their sizes depend on the interpolation schemes
+      const int CVol_Flu = CUBE( CSize_Flu );
+
+//    coarse-grid fluid array for interpolation and fine-grid fluid array storing the interpolation result
+      real  *Flu_CData = new real [ NCOMP_TOTAL*CVol_Flu ];
+      real (*Flu_FData)[FSize_CC][FSize_CC][FSize_CC] = new real [NCOMP_TOTAL][FSize_CC][FSize_CC][FSize_CC];
+
+#     ifdef GRAVITY
+//    coarse-grid potential array for interpolation and fine-grid potential array storing the interpolation result
+      real  *Pot_CData = new real [ CUBE(CSize_Pot) ];
+      real (*Pot_FData)[FSize_CC][FSize_CC] = new real [FSize_CC][FSize_CC][FSize_CC];
+#     endif
+
+#     ifdef MHD
+//    coarse-grid B field array for interpolation and fine-grid B field array storing the interpolation result
+      real  *Mag_CData[NCOMP_MAG];
+      for (int v=0; v<NCOMP_MAG; v++)  Mag_CData[v] = new real [ CSize_Mag_N*SQR(CSize_Mag_T) ];
+      real (*Mag_FData)[ PS2P1*SQR(PS2) ] = new real [NCOMP_MAG][ PS2P1*SQR(PS2) ];
+
+      real *Mag_FInterface_Ptr [6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+      real *Mag_FInterface_Data[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+      for (int s=0; s<6; s++)    Mag_FInterface_Data[s] = new real [ SQR(PS2) ];
+
+//    fine-grid, cell-centered B field for INT_REDUCE_MONO_COEFF
+      real (*Mag_FDataCC_IntIter)[NCOMP_MAG] = new real [ CUBE(FSize_CC) ][NCOMP_MAG];
+#     endif
+
+#     pragma omp for schedule( runtime )
+      for (int t=0; t<NRefine; t++)
+      {
+         const int PID      = RefineList[t];
+         patch_t  *Pedigree = amr->patch[0][lv][PID];  // fixed to Sg=0 for the patch relation
+         const int SonPID0  = Pedigree->son;
+         const int *Cr      = Pedigree->corner;
+
+
+//       (c1.2) allocate child patches at the reserved indices and construct relation : child -> father
+         amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2],       PID, true, true, true, SonPID0+0 );
+         amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2],       PID, true, true, true, SonPID0+1 );
+         amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2],       PID, true, true, true, SonPID0+2 );
+         amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2]+Width, PID, true, true, true, SonPID0+3 );
+         amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2],       PID, true, true, true, SonPID0+4 );
+         amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2]+Width, PID, true, true, true, SonPID0+5 );
+         amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2]+Width, PID, true, true, true, SonPID0+6 );
+         amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2]+Width, PID, true, true, true, SonPID0+7 );
 
 
 //       (c1.3) assign data to child patches by spatial interpolation
@@ -245,7 +282,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
          for (int j=0; j<PS1; j++)  {  j_out = j + CGhost_Flu;
          for (int i=0; i<PS1; i++)  {  i_out = i + CGhost_Flu;
 
-            Flu_CData[v][k_out][j_out][i_out] = amr->patch[CFluSg][lv][PID]->fluid[v][k][j][i];
+            Flu_CData[ v*CVol_Flu + IDX321(i_out,j_out,k_out,CSize_Flu,CSize_Flu) ] = amr->patch[CFluSg][lv][PID]->fluid[v][k][j][i];
 
          }}}}
 
@@ -256,7 +293,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
          for (int j=0; j<PS1; j++)  {  j_out = j + CGhost_Pot;
          for (int i=0; i<PS1; i++)  {  i_out = i + CGhost_Pot;
 
-            Pot_CData[k_out][j_out][i_out] = amr->patch[CPotSg][lv][PID]->pot[k][j][i];
+            Pot_CData[ IDX321(i_out,j_out,k_out,CSize_Pot,CSize_Pot) ] = amr->patch[CPotSg][lv][PID]->pot[k][j][i];
 
          }}}
 #        endif
@@ -319,7 +356,8 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
                for (int j=0; j<loop[1]; j++)  {  j_out = j + offset_out[1];  j_in = j + offset_in[1];
                for (int i=0; i<loop[0]; i++)  {  i_out = i + offset_out[0];  i_in = i + offset_in[0];
 
-                  Flu_CData[v][k_out][j_out][i_out] = amr->patch[CFluSg][lv][SibPID]->fluid[v][k_in][j_in][i_in];
+                  Flu_CData[ v*CVol_Flu + IDX321(i_out,j_out,k_out,CSize_Flu,CSize_Flu) ]
+                     = amr->patch[CFluSg][lv][SibPID]->fluid[v][k_in][j_in][i_in];
 
                }}}}
             } // if ( SibPID >= 0 )
@@ -349,25 +387,25 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
                {
 #                 if ( MODEL == HYDRO )
                   case BC_FLU_OUTFLOW:
-                     Hydro_BoundaryCondition_Outflow   ( Flu_CData[0][0][0], BC_Face[BC_Sibling], NCOMP_TOTAL, CGhost_Flu,
+                     Hydro_BoundaryCondition_Outflow   ( Flu_CData,          BC_Face[BC_Sibling], NCOMP_TOTAL, CGhost_Flu,
                                                          CSize_Flu, CSize_Flu, CSize_Flu, BC_Idx_Start, BC_Idx_End );
                   break;
 
                   case BC_FLU_REFLECTING:
-                     Hydro_BoundaryCondition_Reflecting( Flu_CData[0][0][0], BC_Face[BC_Sibling], NCOMP_TOTAL, CGhost_Flu,
+                     Hydro_BoundaryCondition_Reflecting( Flu_CData,          BC_Face[BC_Sibling], NCOMP_TOTAL, CGhost_Flu,
                                                          CSize_Flu, CSize_Flu, CSize_Flu, BC_Idx_Start, BC_Idx_End,
                                                          FluVarIdxList, NDer, DerVarList );
                   break;
 
                   case BC_FLU_DIODE:
-                     Hydro_BoundaryCondition_Diode     ( Flu_CData[0][0][0], BC_Face[BC_Sibling], NCOMP_TOTAL, CGhost_Flu,
+                     Hydro_BoundaryCondition_Diode     ( Flu_CData,          BC_Face[BC_Sibling], NCOMP_TOTAL, CGhost_Flu,
                                                          CSize_Flu, CSize_Flu, CSize_Flu, BC_Idx_Start, BC_Idx_End,
                                                          FluVarIdxList, NDer, DerVarList );
                   break;
 #                 endif
 
                   case BC_FLU_USER:
-                     Flu_BoundaryCondition_User        ( Flu_CData[0][0][0],                      NCOMP_TOTAL,
+                     Flu_BoundaryCondition_User        ( Flu_CData,                               NCOMP_TOTAL,
                                                          CSize_Flu, CSize_Flu, CSize_Flu, BC_Idx_Start, BC_Idx_End,
                                                          FluVarIdxList, Time[lv], amr->dh[lv], xyz_flu, _TOTAL, lv );
                   break;
@@ -408,7 +446,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
                for (int j=0; j<loop[1]; j++)  {  j_out = j + offset_out[1];  j_in = j + offset_in[1];
                for (int i=0; i<loop[0]; i++)  {  i_out = i + offset_out[0];  i_in = i + offset_in[0];
 
-                  Pot_CData[k_out][j_out][i_out] = amr->patch[CPotSg][lv][SibPID]->pot[k_in][j_in][i_in];
+                  Pot_CData[ IDX321(i_out,j_out,k_out,CSize_Pot,CSize_Pot) ] = amr->patch[CPotSg][lv][SibPID]->pot[k_in][j_in][i_in];
 
                }}}
             } // if ( SibPID >= 0 )
@@ -435,7 +473,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 #              endif
 
 //             extrapolate potential
-               Poi_BoundaryCondition_Extrapolation( Pot_CData[0][0], BC_Face[BC_Sibling], 1, CGhost_Pot,
+               Poi_BoundaryCondition_Extrapolation( Pot_CData,       BC_Face[BC_Sibling], 1, CGhost_Pot,
                                                     CSize_Pot, CSize_Pot, CSize_Pot, BC_Idx_Start, BC_Idx_End );
             }
 
@@ -696,28 +734,26 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
          {
 //          get the wrapped phase (store in the REAL component)
 #           ifdef GAMER_DEBUG
-            ELBDM_GetPhase_DebugOnly( &Flu_CData[0][0][0][0], CSize_Flu );
+            ELBDM_GetPhase_DebugOnly( Flu_CData, CSize_Flu );
 #           else
-            for (int k=0; k<CSize_Flu; k++)
-            for (int j=0; j<CSize_Flu; j++)
-            for (int i=0; i<CSize_Flu; i++)
-               Flu_CData[REAL][k][j][i] = SATAN2( Flu_CData[IMAG][k][j][i], Flu_CData[REAL][k][j][i] );
+            for (int t=0; t<CVol_Flu; t++)
+               Flu_CData[ REAL*CVol_Flu + t ] = SATAN2( Flu_CData[ IMAG*CVol_Flu + t ], Flu_CData[ REAL*CVol_Flu + t ] );
 #           endif
 
 //          interpolate density
-            Interpolate( &Flu_CData[DENS][0][0][0], CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[DENS][0][0][0],
+            Interpolate( Flu_CData+DENS*CVol_Flu,   CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[DENS][0][0][0],
                          FSize_CC3, FStart_CC, 1, OPT__REF_FLU_INT_SCHEME, PhaseUnwrapping_No, &Monotonicity_Yes,
                          IntOppSign0thOrder_No, ALL_CONS_NO, INT_PRIM_NO, INT_FIX_MONO_COEFF, NULL, NULL );
 
 //          interpolate phase
-            Interpolate( &Flu_CData[REAL][0][0][0], CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[REAL][0][0][0],
+            Interpolate( Flu_CData+REAL*CVol_Flu,   CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[REAL][0][0][0],
                          FSize_CC3, FStart_CC, 1, OPT__REF_FLU_INT_SCHEME, PhaseUnwrapping_Yes, &Monotonicity_No,
                          IntOppSign0thOrder_No, ALL_CONS_NO, INT_PRIM_NO, INT_FIX_MONO_COEFF, NULL, NULL );
          }
 
          else // if ( OPT__INT_PHASE )
          {
-            Interpolate( &Flu_CData[0][0][0][0], CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[0][0][0][0],
+            Interpolate( Flu_CData,               CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[0][0][0][0],
                          FSize_CC3, FStart_CC, NCOMP_TOTAL, OPT__REF_FLU_INT_SCHEME, PhaseUnwrapping_No, Monotonicity,
                          IntOppSign0thOrder_No, ALL_CONS_NO, INT_PRIM_NO, INT_FIX_MONO_COEFF, NULL, NULL );
          }
@@ -766,7 +802,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 
 //       adopt INT_PRIM_NO to ensure conservation
 //       --> no need to prepare the coarse-grid, cell-centered B field
-         Interpolate( &Flu_CData[0][0][0][0], CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[0][0][0][0],
+         Interpolate( Flu_CData,               CSize_Flu3, CStart_Flu, CRange_CC, &Flu_FData[0][0][0][0],
                       FSize_CC3, FStart_CC, NCOMP_TOTAL, OPT__REF_FLU_INT_SCHEME,
                       PhaseUnwrapping_No, Monotonicity,
                       INT_OPP_SIGN_0TH_ORDER, ALL_CONS_YES, INT_PRIM_NO, INT_REDUCE_MONO_COEFF,
@@ -780,7 +816,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
          const int CSize_Pot_Temp[3] = { CSize_Pot, CSize_Pot, CSize_Pot };
 
          if ( UsePot )
-         Interpolate( &Pot_CData[0][0][0], CSize_Pot_Temp, CStart_Pot, CRange_CC, &Pot_FData[0][0][0],
+         Interpolate( Pot_CData,          CSize_Pot_Temp, CStart_Pot, CRange_CC, &Pot_FData[0][0][0],
                       FSize_CC3, FStart_CC, 1, OPT__REF_POT_INT_SCHEME, PhaseUnwrapping_No, &Monotonicity_No,
                       IntOppSign0thOrder_No, ALL_CONS_NO, INT_PRIM_NO, INT_FIX_MONO_COEFF, NULL, NULL );
 #        endif
@@ -869,7 +905,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 //       (c1.3.5) copy data from XXX_FData[] to patch pointers
          for (int LocalID=0; LocalID<8; LocalID++)
          {
-            const int SonPID = amr->num[lv+1] - 8 + LocalID;
+            const int SonPID = SonPID0 + LocalID;
 
             offset_in[0] = TABLE_02( LocalID, 'x', 0, PS1 );
             offset_in[1] = TABLE_02( LocalID, 'y', 0, PS1 );
@@ -942,12 +978,30 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
          } // for (int LocalID=0; LocalID<8; LocalID++)
 
 
-//       (c1.4) pass particles from father to son
-#        ifdef PARTICLE
-         Par_PassParticle2Son_SinglePatch( lv, PID );
-#        endif
-      } // if ( Pedigree->flag  &&  Pedigree->son == -1 )
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      } // for (int t=0; t<NRefine; t++)
+
+      delete [] Flu_CData;
+      delete [] Flu_FData;
+#     ifdef GRAVITY
+      delete [] Pot_CData;
+      delete [] Pot_FData;
+#     endif
+#     ifdef MHD
+      for (int v=0; v<NCOMP_MAG; v++)  delete [] Mag_CData[v];
+      delete [] Mag_FData;
+      for (int s=0; s<6; s++)    delete [] Mag_FInterface_Data[s];
+      delete [] Mag_FDataCC_IntIter;
+#     endif
+   } // OpenMP parallel region
+
+
+// (c1.4) pass particles from father to son
+//        --> done serially after all child patches have been allocated
+#  ifdef PARTICLE
+   for (int t=0; t<NRefine; t++)    Par_PassParticle2Son_SinglePatch( lv, RefineList[t] );
+#  endif
+
+   delete [] RefineList;
 
 
 // (c2) remove unflagged child patches (deallocate one patch group at a time)
@@ -1013,9 +1067,7 @@ void Refine( const int lv, const UseLBFunc_t UseLBFunc )
 
 // free memory
 #  ifdef MHD
-   for (int s=0; s<6; s++)    delete [] Mag_FInterface_Data[s];
    delete [] JustRefined;
-   delete [] Mag_FDataCC_IntIter;
 #  endif
 
 // initialize the amr->NPatchComma list for the buffer patches
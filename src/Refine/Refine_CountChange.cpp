@@ -0,0 +1,67 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Refine_CountChange
+// Description :  Count the number of patches at level "lv" whose refinement status will be changed by Refine()
+//
+// Note        :  1. A patch changes its refinement status if it is flagged but has no son, or if it is not
+//                   flagged but has sons
+//                   --> These patches are exactly the father patches that Refine() will allocate/deallocate
+//                       son patches for
+//                2. Invoked by EvolveLevel() for OPT__REGRID_SKIP_UNCHANGED
+//                   --> Refine() can be skipped if the returned number is zero since it would then reproduce the
+//                       current patches, sibling relations, and MPI lists at both levels "lv" and "lv+1"
+//                   --> Note that this is NOT an incremental regrid: if any patch changes, Refine() still
+//                       rebuilds the tree, sibling relations, and MPI lists at both levels from scratch
+//                3. Must be invoked AFTER flagging (i.e., Flag_Real() and Flag_Buffer()) but BEFORE Refine()
+//                4. The returned number is summed over all ranks so that all ranks reach the same decision
+//                5. For the load-balance mode, only real patches are checked since LB_Refine() determines the
+//                   new/deleted son patches using real patches only
+//                   --> For the non-load-balance mode, buffer patches are also checked since Refine() also
+//                       reconstructs their son patches
+//
+// Parameter   :  lv        : Target refinement level
+//                UseLBFunc : Use the load-balance alternative function
+//                            --> USELB_YES : use the load-balance alternative function
+//                                USELB_NO  : do not use the load-balance alternative function
+//
+// Return      :  Total number of patches at level "lv" whose refinement status will be changed
+//-------------------------------------------------------------------------------------------------------
+long Refine_CountChange( const int lv, const UseLBFunc_t UseLBFunc )
+{
+
+// nothing to do on the top level
+   if ( lv == TOP_LEVEL )  return 0;
+
+
+// check both real and buffer patches for the non-load-balance mode
+#  ifdef LOAD_BALANCE
+   const int NPatch = ( UseLBFunc == USELB_YES ) ? amr->NPatchComma[lv][1] : amr->NPatchComma[lv][27];
+#  else
+   const int NPatch = amr->NPatchComma[lv][27];
+
+   (void)UseLBFunc;  // only used by the load-balance mode
+#  endif
+
+   long NChange_ThisRank=0, NChange_AllRank;
+
+#  pragma omp parallel for reduction( +:NChange_ThisRank ) schedule( runtime )
+   for (int PID=0; PID<NPatch; PID++)
+   {
+      const patch_t *Pedigree = amr->patch[0][lv][PID];   // fixed to Sg=0 for the patch relation
+      const bool     HasSon   = ( Pedigree->son != -1 );
+
+      if ( Pedigree->flag != HasSon )  NChange_ThisRank ++;
+   }
+
+
+// sum over all ranks
+   MPI_Allreduce( &NChange_ThisRank, &NChange_AllRank, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+
+
+   return NChange_AllRank;
+
+} // FUNCTION : Refine_CountChange
@@ -11,6 +11,13 @@ void CPU_SrcSolver_IterateAllCells(
    const SrcTerms_t SrcTerms, const int NPatchGroup, const real dt, const real dh,
    const double TimeNew, const double TimeOld,
    const real MinDens, const real MinPres, const real MinEint, const EoS_t EoS );
+#if ( MODEL == HYDRO )
+void CPU_SrcSolver_ExactCooling(
+   const real g_Flu_Array_In [][FLU_NIN_S ][ CUBE(SRC_NXT)           ],
+         real g_Flu_Array_Out[][FLU_NOUT_S][ CUBE(PS1)               ],
+   const real g_Mag_Array_In [][NCOMP_MAG ][ SRC_NXT_P1*SQR(SRC_NXT) ],
+   const SrcTerms_t SrcTerms, const int NPatchGroup, const real dt );
+#endif
 
 
 
@@ -25,6 +32,8 @@ void CPU_SrcSolver_IterateAllCells(
 //                2. Use patches instead of patch groups as the basic unit
 //                3. No ghost zones
 //                   --> Should support ghost zones in the future
+//                4. Invoke the batched solver CPU_SrcSolver_ExactCooling() when the exact cooling is the only
+//                   enabled source term
 //
 // Parameter   :  h_Flu_Array_In    : Host array storing the input fluid variables
 //                h_Flu_Array_Out   : Host array to store the output fluid variables
@@ -59,6 +68,11 @@ void CPU_SrcSolver( const real h_Flu_Array_In [][FLU_NIN_S ][ CUBE(SRC_NXT)
 #  endif
 
 
+#  if ( MODEL == HYDRO )
+   if ( SrcTerms.ExactCooling  &&  !SrcTerms.Deleptonization  &&  !SrcTerms.User )
+      CPU_SrcSolver_ExactCooling( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, SrcTerms, NPatchGroup, dt );
+   else
+#  endif
    CPU_SrcSolver_IterateAllCells( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, h_Corner_Array,
                                   SrcTerms, NPatchGroup, dt, dh, TimeNew, TimeOld,
                                   MinDens, MinPres, MinEint, EoS );
@@ -15,6 +15,171 @@
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_AdvanceOneTerm
+// Description :  Advance a single cell by dt with the target source-term function
+//
+// Note        :  1. Invoked by Src_AdvanceAllTerms()
+//                2. Apply the source-term function once if SrcTerms->SubcycleTol <= 0.0
+//                3. Otherwise subcycle adaptively by step doubling
+//                   --> Compare one full substep with two half substeps and accept the latter only if
+//                       the maximum relative difference among all fields is <= SrcTerms->SubcycleTol
+//                   --> Halve the substep if rejected and double it if the difference is < SubcycleTol/4
+//                   --> Advance the remaining interval in one step after SrcTerms->SubcycleMaxNSub trials
+//                4. Not applied to the exact cooling, which is already exact for any dt
+//
+// Parameter   :  FuncPtr    : Source-term function to be applied
+//                fluid      : Fluid array storing both the input and updated values
+//                AuxArray_* : Auxiliary arrays of the target source term
+//                Others     : See CPU/GPU_SrcSolver_IterateAllCells()
+//
+// Return      :  fluid[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+void Src_AdvanceOneTerm( const SrcFunc_t FuncPtr, real fluid[], const real B[], const SrcTerms_t *SrcTerms,
+                         const real dt, const real dh, const double x, const double y, const double z,
+                         const double TimeNew, const double TimeOld,
+                         const real MinDens, const real MinPres, const real MinEint, const EoS_t *EoS,
+                         const double AuxArray_Flt[], const int AuxArray_Int[] )
+{
+
+// single update
+   if ( SrcTerms->SubcycleTol <= 0.0 )
+   {
+      FuncPtr( fluid, B, SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, EoS,
+               AuxArray_Flt, AuxArray_Int );
+      return;
+   }
+
+
+// adaptive subcycling
+   const real   Tol   = (real)SrcTerms->SubcycleTol;
+   const double dTime = TimeNew - TimeOld;
+
+   real Full[FLU_NIN_S], Half[FLU_NIN_S];
+   real t = (real)0.0;
+   real h = dt;
+
+   for (int NSub=1; true; NSub++)
+   {
+      const bool Last = ( h >= dt - t );
+      if ( Last )    h = dt - t;
+
+      const double TimeSubOld = TimeOld + dTime*( t/dt );
+      const double TimeSubMid = TimeOld + dTime*( (t+(real)0.5*h)/dt );
+      const double TimeSubNew = ( Last ) ? TimeNew : TimeOld + dTime*( (t+h)/dt );
+
+//    too many substeps --> advance the remaining interval in one step
+      if ( NSub >= SrcTerms->SubcycleMaxNSub )
+      {
+         FuncPtr( fluid, B, SrcTerms, dt-t, dh, x, y, z, TimeNew, TimeSubOld, MinDens, MinPres, MinEint, EoS,
+                  AuxArray_Flt, AuxArray_Int );
+         break;
+      }
+
+//    one full substep and two half substeps
+      for (int v=0; v<FLU_NIN_S; v++)  Full[v] = Half[v] = fluid[v];
+
+      FuncPtr( Full, B, SrcTerms, h,             dh, x, y, z, TimeSubNew, TimeSubOld, MinDens, MinPres, MinEint, EoS,
+               AuxArray_Flt, AuxArray_Int );
+      FuncPtr( Half, B, SrcTerms, (real)0.5*h,   dh, x, y, z, TimeSubMid, TimeSubOld, MinDens, MinPres, MinEint, EoS,
+               AuxArray_Flt, AuxArray_Int );
+      FuncPtr( Half, B, SrcTerms, h-(real)0.5*h, dh, x, y, z, TimeSubNew, TimeSubMid, MinDens, MinPres, MinEint, EoS,
+               AuxArray_Flt, AuxArray_Int );
+
+//    estimate the relative error
+      real Err = (real)0.0;
+      for (int v=0; v<FLU_NOUT_S; v++)
+         Err = FMAX(  Err, FABS( Half[v] - Full[v] ) / ( FMAX( FABS(Half[v]), FABS(fluid[v]) ) + TINY_NUMBER )  );
+
+//    accept or reject this substep
+      if ( Err <= Tol )
+      {
+         for (int v=0; v<FLU_NIN_S; v++)  fluid[v] = Half[v];
+
+         if ( Last )    break;
+
+         t += h;
+         if ( Err < (real)0.25*Tol )   h *= (real)2.0;
+      }
+
+      else
+         h *= (real)0.5;
+   } // for (int NSub=1; true; NSub++)
+
+} // FUNCTION : Src_AdvanceOneTerm
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_AdvanceAllTerms
+// Description :  Advance a single cell by dt with all enabled source terms
+//
+// Note        :  1. Invoked by CPU/GPU_SrcSolver_IterateAllCells() and CPU_SrcSolver_AdvanceCell()
+//                2. Source terms are applied one by one in the order of deleptonization, exact cooling,
+//                   and user-defined
+//
+// Parameter   :  fluid  : Fluid array storing both the input and updated values
+//                Others : See CPU/GPU_SrcSolver_IterateAllCells()
+//
+// Return      :  fluid[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+void Src_AdvanceAllTerms( real fluid[], const real B[], const SrcTerms_t *SrcTerms,
+                          const real dt, const real dh, const double x, const double y, const double z,
+                          const double TimeNew, const double TimeOld,
+                          const real MinDens, const real MinPres, const real MinEint, const EoS_t *EoS )
+{
+
+// (1) deleptonization
+#  if ( MODEL == HYDRO )
+   if ( SrcTerms->Deleptonization )
+      Src_AdvanceOneTerm( SrcTerms->Dlep_FuncPtr, fluid, B, SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld,
+                          MinDens, MinPres, MinEint, EoS,
+                          SrcTerms->Dlep_AuxArrayDevPtr_Flt, SrcTerms->Dlep_AuxArrayDevPtr_Int );
+// (2) exact cooling
+   if ( SrcTerms->ExactCooling )
+      SrcTerms->EC_FuncPtr( fluid, B, SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, EoS,
+                            SrcTerms->EC_AuxArrayDevPtr_Flt, SrcTerms->EC_AuxArrayDevPtr_Int );
+#  endif
+
+// (3) user-defined
+   if ( SrcTerms->User )
+      Src_AdvanceOneTerm( SrcTerms->User_FuncPtr, fluid, B, SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld,
+                          MinDens, MinPres, MinEint, EoS,
+                          SrcTerms->User_AuxArrayDevPtr_Flt, SrcTerms->User_AuxArrayDevPtr_Int );
+
+} // FUNCTION : Src_AdvanceAllTerms
+
+
+
+#ifndef __CUDACC__
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_SrcSolver_AdvanceCell
+// Description :  Advance a single cell by dt with all enabled source terms on the CPU
+//
+// Note        :  1. Invoked by Flu_Close() when SRC_FUSE_FLUID is on
+//                   --> Apply the local source terms directly to the output of the fluid solver without
+//                       invoking Src_Prepare() and Src_Close()
+//                2. Always use the per-cell exact-cooling solver instead of CPU_SrcSolver_ExactCooling()
+//
+// Parameter   :  See Src_AdvanceAllTerms()
+//
+// Return      :  fluid[]
+//-------------------------------------------------------------------------------------------------------
+void CPU_SrcSolver_AdvanceCell( real fluid[], const real B[], const SrcTerms_t *SrcTerms,
+                                const real dt, const real dh, const double x, const double y, const double z,
+                                const double TimeNew, const double TimeOld,
+                                const real MinDens, const real MinPres, const real MinEint, const EoS_t *EoS )
+{
+
+   Src_AdvanceAllTerms( fluid, B, SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, EoS );
+
+} // FUNCTION : CPU_SrcSolver_AdvanceCell
+#endif // #ifndef __CUDACC__
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  CPU/GPU_SrcSolver_IterateAllCells
 // Description :  Iterate over all cells to add each source term
@@ -22,6 +187,8 @@
 // Note        :  1. Invoked by CPU_SrcSolver() and CUAPI_Asyn_SrcSolver()
 //                2. No ghost zones
 //                   --> Should support ghost zones in the future
+//                3. Non-exact source terms (i.e., deleptonization and user-defined) can be subcycled adaptively
+//                   on each cell (see Src_AdvanceOneTerm())
 //
 // Parameter   :  g_Flu_Array_In    : Array storing the input fluid variables
 //                g_Flu_Array_Out   : Array to store the output fluid variables
@@ -107,21 +274,7 @@ void CPU_SrcSolver_IterateAllCells(
 
 
 //       add all source terms one by one
-//       (1) deleptonization
-#        if ( MODEL == HYDRO )
-         if ( SrcTerms.Deleptonization )
-            SrcTerms.Dlep_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
-                                   SrcTerms.Dlep_AuxArrayDevPtr_Flt, SrcTerms.Dlep_AuxArrayDevPtr_Int );
-//       (2) exact cooling
-         if ( SrcTerms.ExactCooling )
-            SrcTerms.EC_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
-                                 SrcTerms.EC_AuxArrayDevPtr_Flt, SrcTerms.EC_AuxArrayDevPtr_Int );
-#        endif
-
-//       (3) user-defined
-         if ( SrcTerms.User )
-            SrcTerms.User_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
-                                   SrcTerms.User_AuxArrayDevPtr_Flt, SrcTerms.User_AuxArrayDevPtr_Int );
+         Src_AdvanceAllTerms( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS );
 
 //       store the updated results
          for (int v=0; v<FLU_NOUT_S; v++)   g_Flu_Array_Out[p][v][idx_out] = fluid[v];
@@ -14,14 +14,41 @@
 extern double *d_SrcEC_TEF_lambda;
 extern double *d_SrcEC_TEF_alpha;
 extern double *d_SrcEC_TEFc;
+extern double *d_SrcEC_TEF_Coeff;
 
 #endif // #ifdef __CUDACC__
 
 
+// indices of the per-interval coefficients stored in h_SrcEC_TEF_Coeff[ k*SRC_EC_TEF_NCOEFF + index ]
+// --> see Src_Init_ExactCooling() for their definitions
+#define SRC_EC_TEF_TK      0     // Tk : lower temperature bound of the interval k
+#define SRC_EC_TEF_FWD     1     // coefficient of the power-law term in TEF()
+#define SRC_EC_TEF_INV     2     // coefficient of the power-law term in TEFinv()
+#define SRC_EC_TEF_EXP     3     // exponent 1/(1-alpha_k) in TEFinv()
+
+// indices of the per-interval data stored in h_SrcEC_TEF_Mixed[ k*SRC_EC_MIX_NVAR + index ] for the mixed-precision mode
+// --> same as h_SrcEC_TEF_lambda/alpha/Coeff[] but in single precision and grouped together
+#define SRC_EC_MIX_TK      0
+#define SRC_EC_MIX_LAMBDA  1
+#define SRC_EC_MIX_ALPHA   2
+#define SRC_EC_MIX_FWD     3
+#define SRC_EC_MIX_INV     4
+#define SRC_EC_MIX_EXP     5
+#define SRC_EC_MIX_NVAR    6
+
+// vectorizable exp() and log() in real used by the mixed-precision mode
+#ifdef FLOAT8
+#  define EC_EXP( x )      Src_ExactCooling_Exp ( x )
+#  define EC_LOG( x )      Src_ExactCooling_Log ( x )
+#else
+#  define EC_EXP( x )      Src_ExactCooling_ExpF( x )
+#  define EC_LOG( x )      Src_ExactCooling_LogF( x )
+#endif
+
+
 // local function prototypes
 #ifndef __CUDACC__
 
-extern bool   IsInit_tcool[NLEVEL];
 void Src_SetAuxArray_ExactCooling( double [], int [] );
 void Src_SetConstMemory_ExactCooling( const double AuxArray_Flt[], const int AuxArray_Int[],
                                       double *&DevPtr_Flt, int *&DevPtr_Int );
@@ -33,19 +60,61 @@ void Src_SetGPUFunc_ExactCooling( SrcFunc_t & );
 #ifdef GPU
 void CUAPI_MemFree_ExactCooling();
 #endif
-static bool IsInit = false;
 void Src_WorkBeforeMajorFunc_ExactCooling( const int lv, const double TimeNew, const double TimeOld, const double dt,
                                            double AuxArray_Flt[], int AuxArray_Int[] );
 void Src_End_ExactCooling();
 
 void Cool_fct( double Dens, double Temp, double* Emis, double* Lambdat, double Z, double cl_moli_mole, double mp );
+void Src_LoadCoolingTable_ExactCooling( const char *FileName, const int NZ, const double Z[], const int NT,
+                                        const double Temp[], double Lambda[] );
+bool Src_LoadTEFCache_ExactCooling( const char *FileName, const char *TableName, const double LambdaUnit,
+                                    double TEF_lambda[], double TEF_alpha[], double TEFc[], double TEF_Coeff[] );
+void Src_SaveTEFCache_ExactCooling( const char *FileName, const char *TableName, const double LambdaUnit,
+                                    const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
+                                    const double TEF_Coeff[] );
+static void Src_BuildTEF_ExactCooling( const double cl_mol, double TEF_lambda[], double TEF_alpha[], double TEFc[],
+                                       double TEF_Coeff[] );
 #endif
 GPU_DEVICE static
-double TEF( double TEMP, int k, const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
-            const double AuxArray_Flt[], const int AuxArray_Int[] );
+double TEF( const double TEMP, const int k, const double lambdaTEMP, const double TEF_lambda[], const double TEF_alpha[],
+            const double TEFc[], const double TEF_Coeff[] );
+GPU_DEVICE static
+double TEFinv( const double Y, const int k, const double TEF_alpha[], const double TEFc[], const double TEF_Coeff[] );
+GPU_DEVICE static
+int TEF_SearchInterval( const double Y, const int k, const double TEFc[] );
+GPU_DEVICE static
+double Src_ExactCooling_Ynew( const double Tini, const real Dens, const real dt, const double TEF_lambda[],
+                              const double TEF_alpha[], const double TEFc[], const double TEF_Coeff[],
+                              const double AuxArray_Flt[], const int AuxArray_Int[], int *k, double *tcool );
 GPU_DEVICE static
-double TEFinv( double Y, int k, const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
-               const double AuxArray_Flt[], const int AuxArray_Int[] );
+double Src_ExactCooling_NewTemp( const double Ynew, const int k, const double TEF_alpha[], const double TEFc[],
+                                 const double TEF_Coeff[], const double AuxArray_Flt[], const int AuxArray_Int[],
+                                 int *knew );
+GPU_DEVICE static
+int Src_ExactCooling_NewInterval( const double Ynew, const int k, const double TEFc[], const int AuxArray_Int[] );
+GPU_DEVICE static
+double Src_ExactCooling_ZWeight( const real Dens, const real Metal, const double AuxArray_Flt[], const int AuxArray_Int[],
+                                 int *z0 );
+#ifndef GPU
+static inline double Src_ExactCooling_Exp( const double x );
+static inline double Src_ExactCooling_Log( const double x );
+static inline float Src_ExactCooling_ExpF( const float x );
+static inline float Src_ExactCooling_LogF( const float x );
+static inline double Src_ExactCooling_Ynew_Vec( const double Tini, const real Dens, const real dt,
+                                                const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
+                                                const double TEF_Coeff[], const double AuxArray_Flt[],
+                                                const int AuxArray_Int[], int *k, double *tcool );
+static inline double Src_ExactCooling_TEFinv_Vec( const double Y, const int knew, const double TEF_alpha[],
+                                                  const double TEFc[], const double TEF_Coeff[],
+                                                  const double AuxArray_Flt[] );
+static inline double Src_ExactCooling_Ynew_Mixed( const real Tini, const real Dens, const real dt, const int t0,
+                                                  const real TEF_Mixed[], const double TEFc[], const double AuxArray_Flt[],
+                                                  const int AuxArray_Int[], int *k, double *tcool );
+static inline real Src_ExactCooling_TEFinv_Mixed( const double Y, const int knew, const int t0, const real TEF_Mixed[],
+                                                  const double TEFc[], const double AuxArray_Flt[] );
+static void Src_ExactCooling_NewInterval_Patch( const double Ynew[], const int k[], const int t0[], const double TEFc[],
+                                                const int AuxArray_Int[], int knew[] );
+#endif
 
 
 /********************************************************
@@ -79,7 +148,7 @@ double TEFinv( double Y, int k, const double TEF_lambda[], const double TEF_alph
 // Description :  Set the auxiliary arrays AuxArray_Flt/Int[]
 //
 // Note        :  1. Invoked by Src_Init_ExactCooling()
-//                2. AuxArray_Flt/Int[] have the size of SRC_NAUX_USER defined in Macro.h (default = 10)
+//                2. AuxArray_Flt/Int[] have the size of SRC_NAUX_EC defined in Macro.h (default = 20)
 //                3. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
 //
 // Parameter   :  AuxArray_Flt/Int : Floating-point/Integer arrays to be filled up
@@ -101,13 +170,17 @@ void Src_SetAuxArray_ExactCooling( double AuxArray_Flt[], int AuxArray_Int[] )
 #  endif
    const double TEF_dltemp = (log10(TEF_TN) - log10(TEF_Tmin))/TEF_int;   // sampling resolution (Kelvin), LOG!
 
-   const double cl_X         = 0.7;      // mass-fraction of hydrogen
-   const double cl_Z         = 0.018;    // metallicity (in Zsun)
+   const double cl_X         = SrcTerms.EC_X;   // mass-fraction of hydrogen
+   const double cl_Z         = SrcTerms.EC_Z;   // metallicity (in Zsun)
    const double cl_mol       = 1.0/(2*cl_X+0.75*(1-cl_X-cl_Z)+cl_Z*0.5);   // mean (total) molecular weights 
    const double cl_mole      = 2.0/(1+cl_X);   // mean electron molecular weights
    const double cl_moli      = 1.0/cl_X;   // mean proton molecular weights
    const double cl_moli_mole = cl_moli*cl_mole;  // Assume the molecular weights are constant, mu_e*mu_i = 1.464
 
+   const int    TEF_NZ       = SrcTerms.EC_NZ;   // number of TEF tables sampled linearly in metallicity
+   const double TEF_ZMin     = SrcTerms.EC_ZMin;   // metallicity of the first TEF table
+   const double TEF_dZ       = ( TEF_NZ > 1 ) ? (SrcTerms.EC_ZMax - SrcTerms.EC_ZMin)/(TEF_NZ-1) : 1.0;
+
 // Store them in the aux array 
    AuxArray_Flt[0] = 1.0/(GAMMA-1.0);
    AuxArray_Flt[1] = TEF_TN;
@@ -118,9 +191,14 @@ void Src_SetAuxArray_ExactCooling( double AuxArray_Flt[], int AuxArray_Int[] )
    AuxArray_Flt[6] = cl_mol;
    AuxArray_Flt[7] = MU_NORM/UNIT_M; 
    AuxArray_Flt[8] = (Const_kB/UNIT_E) * (MU_NORM/UNIT_M);   //kB*mp
+   AuxArray_Flt[9] = log10(TEF_Tmin);
+   AuxArray_Flt[10] = TEF_ZMin;
+   AuxArray_Flt[11] = 1.0/TEF_dZ;
 
    AuxArray_Int[0] = TEF_N;
-   
+   AuxArray_Int[1] = 0;   // whether TEFc[] is strictly decreasing (will be set by Src_Init_ExactCooling())
+   AuxArray_Int[2] = TEF_NZ;
+   AuxArray_Int[3] = Idx_Metal;   // only used when TEF_NZ > 1
 
 } // FUNCTION : Src_SetAuxArray_ExactCooling
 #endif // #ifndef __CUDACC__
@@ -170,28 +248,30 @@ static void Src_ExactCooling( real fluid[], const real B[],
 #  endif
 
 
-   const int    TEF_N        = AuxArray_Int[0];   // number of points for lambda(T) sampling in LOG
-   const double cl_CV        = AuxArray_Flt[0];   // 1.0/(GAMMA-1.0)
-   const double TEF_TN       = AuxArray_Flt[1];   // == Tref, high enough, but affects sampling resolution
    const double TEF_Tmin     = AuxArray_Flt[2];   // MIN temperature 
-   const double TEF_dltemp   = AuxArray_Flt[3];   // sampling resolution (Kelvin), LOG!
    const double cl_moli_mole = AuxArray_Flt[5];   // Assume the molecular weights are constant, mu_e*mu_i = 1.464 
    const double cl_mol       = AuxArray_Flt[6];   // mean (total) molecular weights 
    const double cl_mp        = AuxArray_Flt[7];   // proton mass
    const double cl_kB_mp     = AuxArray_Flt[8];   // Boltzmann constant in erg/K
+   const int    TEF_N        = AuxArray_Int[0];   // number of points for lambda(T) sampling in LOG
+   const int    TEF_NZ       = AuxArray_Int[2];   // number of TEF tables sampled in metallicity
+   const int    Idx_Z        = AuxArray_Int[3];   // field index of the metal density (for TEF_NZ > 1 only)
 
 #  ifdef __CUDACC__
    const double *TEF_lambda = SrcTerms->EC_TEF_lambda_DevPtr;
    const double *TEF_alpha  = SrcTerms->EC_TEF_alpha_DevPtr;
    const double *TEFc       = SrcTerms->EC_TEFc_DevPtr;
+   const double *TEF_Coeff  = SrcTerms->EC_TEF_Coeff_DevPtr;
 #  else
    const double *TEF_lambda = h_SrcEC_TEF_lambda;
    const double *TEF_alpha  = h_SrcEC_TEF_alpha;
    const double *TEFc       = h_SrcEC_TEFc;
+   const double *TEF_Coeff  = h_SrcEC_TEF_Coeff;
 #  endif
 
-   double Temp, Eint, Enth, Emag, Pres, rho_num, Tini, Eintf, dedtmean, Tk, lambdaTini, tcool, Ynew;
-   int k, knew;
+   double Temp, Eint, Enth, Emag, Pres, rho_num, Tini, Eintf, dedtmean, tcool, Ynew;
+   double wZ, tcool1, Ynew1;
+   int k, knew, k1, knew1, z0;
    const bool CheckMinTemp_Yes = true;
 
 // (1) Get the temperature and compute the old internal energy
@@ -212,27 +292,40 @@ static void Src_ExactCooling( real fluid[], const real B[],
 #  endif
 
 #  ifdef __CUDACC__ 
-   Pres = EoS->DensTemp2Pres_FuncPtr( fluid[DENS], Temp, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-   Eint = EoS->DensPres2Eint_FuncPtr( fluid[DENS], Pres, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+   Pres = EOS_DENSTEMP2PRES( EoS->DensTemp2Pres_FuncPtr, fluid[DENS], Temp, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+   Eint = EOS_DENSPRES2EINT( EoS->DensPres2Eint_FuncPtr, fluid[DENS], Pres, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
 #  else
-   Pres = EoS_DensTemp2Pres_CPUPtr( fluid[DENS], Temp, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-   Eint = EoS_DensPres2Eint_CPUPtr( fluid[DENS], Pres, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+   Pres = EOS_DENSTEMP2PRES( EoS_DensTemp2Pres_CPUPtr, fluid[DENS], Temp, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+   Eint = EOS_DENSPRES2EINT( EoS_DensPres2Eint_CPUPtr, fluid[DENS], Pres, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
 #  endif
    Enth = fluid[ENGY] - Eint;
    Tini = Temp;
 
-// (2) Decide the index k (an interval) where Tini falls into
-   k = int((log10(Tini)-log10(TEF_Tmin))/TEF_dltemp);   // Note: array index changed, now starts from k=0 
-#  ifdef GAMER_DEBUG
-   if ( k < 0 || k > TEF_N-1 ){
-      printf( "WARNING: Array index invalid (beyond the range of 0 to TEF_N-1)!!\n" );
-      k = NULL_INT;
+// (2) Compute the cooling time and Ynew
+// --> for TEF_NZ > 1, integrate exactly with both TEF tables bracketing the metallicity of this cell
+//     and interpolate the new temperature linearly in Z in step (3)
+   if ( TEF_NZ == 1 )
+      Ynew = Src_ExactCooling_Ynew( Tini, fluid[DENS], dt, TEF_lambda, TEF_alpha, TEFc, TEF_Coeff, AuxArray_Flt, AuxArray_Int,
+                                    &k, &tcool );
+   else {
+      wZ = Src_ExactCooling_ZWeight( fluid[DENS], fluid[Idx_Z], AuxArray_Flt, AuxArray_Int, &z0 );
+
+//    move to the TEF table z0 --> the table z0+1 is at an offset of TEF_N (TEF_N*SRC_EC_TEF_NCOEFF for TEF_Coeff)
+      TEF_lambda += z0*TEF_N;
+      TEF_alpha  += z0*TEF_N;
+      TEFc       += z0*TEF_N;
+      TEF_Coeff  += z0*TEF_N*SRC_EC_TEF_NCOEFF;
+
+      Ynew  = Src_ExactCooling_Ynew( Tini, fluid[DENS], dt, TEF_lambda, TEF_alpha, TEFc, TEF_Coeff,
+                                     AuxArray_Flt, AuxArray_Int, &k, &tcool );
+      Ynew1 = Src_ExactCooling_Ynew( Tini, fluid[DENS], dt, TEF_lambda+TEF_N, TEF_alpha+TEF_N, TEFc+TEF_N,
+                                     TEF_Coeff+TEF_N*SRC_EC_TEF_NCOEFF, AuxArray_Flt, AuxArray_Int, &k1, &tcool1 );
+
+//    interpolate the cooling rate (i.e., 1/tcool) in Z
+      tcool = 1.0/( (1.0-wZ)/tcool + wZ/tcool1 );
    }
-#  endif
-   Tk = POW(10.0, (log10(TEF_Tmin)+k*TEF_dltemp));
-   lambdaTini = TEF_lambda[k] * POW((Tini/Tk), TEF_alpha[k]);
-// Compute the cooling time and store it
-   tcool = cl_CV*Tini/(fluid[DENS]*lambdaTini);
+
+// Store the cooling time
    fluid[TCOOL] = tcool;
 
 // TMP!!
@@ -241,28 +334,21 @@ static void Src_ExactCooling( real fluid[], const real B[],
 //   }
 //   if ( dt == 0.0 )   return;
 
-// (3) Calculate Ynew
-   Ynew  = TEF( Tini, k, TEF_lambda, TEF_alpha, TEFc, AuxArray_Flt, AuxArray_Int ) + (Tini/TEF_TN)*(TEF_lambda[TEF_N-1]/lambdaTini)*(dt/tcool);
-
-// (4) Find the new power law interval where Ynew resides
-   for (int i=k; i>=0; i--){
-      if( Ynew < TEFc[i] ){
-         knew = i;
-         Temp = TEFinv( Ynew, knew, TEF_lambda, TEF_alpha, TEFc, AuxArray_Flt, AuxArray_Int );
-         goto label;
-      }
-   }
-   Temp = TEF_Tmin; // reached the floor: Tn+1 < Tfloor
-   knew = 0;  
-   label: // label for goto statement
+// (3) Find the new power law interval where Ynew resides and compute the new temperature
+   Temp = Src_ExactCooling_NewTemp( Ynew, k, TEF_alpha, TEFc, TEF_Coeff, AuxArray_Flt, AuxArray_Int, &knew );
+
+   if ( TEF_NZ > 1 )
+      Temp = (1.0-wZ)*Temp + wZ*Src_ExactCooling_NewTemp( Ynew1, k1, TEF_alpha+TEF_N, TEFc+TEF_N,
+                                                          TEF_Coeff+TEF_N*SRC_EC_TEF_NCOEFF, AuxArray_Flt, AuxArray_Int,
+                                                          &knew1 );
 
-// (5) Calculate the new internal energy and update fluid[ENGY]
+// (4) Calculate the new internal energy and update fluid[ENGY]
 #  ifdef __CUDACC__           
-   Pres = EoS->DensTemp2Pres_FuncPtr( fluid[DENS], Temp, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
-   Eintf = EoS->DensPres2Eint_FuncPtr( fluid[DENS], Pres, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+   Pres = EOS_DENSTEMP2PRES( EoS->DensTemp2Pres_FuncPtr, fluid[DENS], Temp, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
+   Eintf = EOS_DENSPRES2EINT( EoS->DensPres2Eint_FuncPtr, fluid[DENS], Pres, NULL, EoS->AuxArrayDevPtr_Flt, EoS->AuxArrayDevPtr_Int, EoS->Table );
 #  else                       
-   Pres = EoS_DensTemp2Pres_CPUPtr( fluid[DENS], Temp, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-   Eintf = EoS_DensPres2Eint_CPUPtr( fluid[DENS], Pres, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+   Pres = EOS_DENSTEMP2PRES( EoS_DensTemp2Pres_CPUPtr, fluid[DENS], Temp, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+   Eintf = EOS_DENSPRES2EINT( EoS_DensPres2Eint_CPUPtr, fluid[DENS], Pres, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
 #  endif                      
 
 //   if ( x < 1.2e21 && x > 1.15e21 && y < 0.7e21 && y > 0.65e21 &&  z < 1.4e21 &&  z > 1.35e21 ){ 
@@ -284,49 +370,1043 @@ static void Src_ExactCooling( real fluid[], const real B[],
 } // FUNCTION : Src_ExactCooling
 
 
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_Ynew
+// Description :  Compute the cooling time and the TEF value Ynew after cooling for a time interval dt
+//
+// Note        :  1. Invoked by Src_ExactCooling()
+//                2. Steps (2) and (3) in Gaspari (2009) Section 3.2
+//
+// Parameter   :  Tini             : Initial temperature
+//                Dens             : Gas mass density
+//                dt               : Time interval to advance solution
+//                TEF_*            : TEF tables
+//                AuxArray_Flt/Int : Auxiliary arrays (see Src_SetAuxArray_ExactCooling())
+//                k                : Power-law interval where Tini resides
+//                tcool            : Cooling time
+//
+// Return      :  Ynew, k, tcool
+//-------------------------------------------------------------------------------------------------------
 GPU_DEVICE static
-// the temporal evolution function (TEF)
-double TEF( double TEMP, int k, const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
-            const double AuxArray_Flt[], const int AuxArray_Int[] ){
+double Src_ExactCooling_Ynew( const double Tini, const real Dens, const real dt, const double TEF_lambda[],
+                              const double TEF_alpha[], const double TEFc[], const double TEF_Coeff[],
+                              const double AuxArray_Flt[], const int AuxArray_Int[], int *k, double *tcool )
+{
 
    const int    TEF_N      = AuxArray_Int[0];   // number of points for lambda(T) sampling in LOG
+   const double cl_CV      = AuxArray_Flt[0];   // 1.0/(GAMMA-1.0)
    const double TEF_TN     = AuxArray_Flt[1];   // == Tref, high enough, but affects sampling resolution
-   const double TEF_Tmin   = AuxArray_Flt[2];   // MIN temperature 
    const double TEF_dltemp = AuxArray_Flt[3];   // sampling resolution (Kelvin), LOG!
+   const double TEF_lTmin  = AuxArray_Flt[9];   // log10(TEF_Tmin)
 
-   double TEF, Tk;
-   Tk = POW(10.0, log10(TEF_Tmin) + k*TEF_dltemp);
-// Do the integration in Gapari (2009) Eq. (24)
-   if ( TEF_alpha[k] != 1.0 ){
-       TEF = TEFc[k] + ((1.0/(1.0-TEF_alpha[k])) * (TEF_lambda[TEF_N-1] / TEF_lambda[k]) * (Tk/TEF_TN) * (1.0 - POW((Tk/TEMP), (TEF_alpha[k]-1.0))));
+   double Tk, lambdaTini;
+
+// (1) Decide the index k (an interval) where Tini falls into
+   *k = int((log10(Tini)-TEF_lTmin)/TEF_dltemp);   // Note: array index changed, now starts from k=0 
+#  ifdef GAMER_DEBUG
+   if ( *k < 0 || *k > TEF_N-1 ){
+      printf( "WARNING: Array index invalid (beyond the range of 0 to TEF_N-1)!!\n" );
+      *k = NULL_INT;
    }
-   else   TEF = TEFc[k] + ((TEF_lambda[TEF_N-1]/TEF_lambda[k]) * (Tk/TEF_TN) * log(Tk/TEMP));
-   
+#  endif
+   Tk = TEF_Coeff[ (*k)*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_TK ];
+   lambdaTini = TEF_lambda[*k] * POW((Tini/Tk), TEF_alpha[*k]);
+
+// (2) Compute the cooling time
+   *tcool = cl_CV*Tini/(Dens*lambdaTini);
+
+// (3) Calculate Ynew
+   return TEF( Tini, *k, lambdaTini, TEF_lambda, TEF_alpha, TEFc, TEF_Coeff ) + (Tini/TEF_TN)*(TEF_lambda[TEF_N-1]/lambdaTini)*(dt/(*tcool));
+
+} // FUNCTION : Src_ExactCooling_Ynew
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_NewTemp
+// Description :  Find the power-law interval where Ynew resides and compute the corresponding temperature
+//
+// Note        :  1. Invoked by Src_ExactCooling()
+//                2. Return TEF_Tmin and knew = 0 if the temperature falls below the floor
+//
+// Parameter   :  Ynew             : TEF value after cooling
+//                k                : Power-law interval of the initial temperature
+//                TEF_*            : TEF tables
+//                AuxArray_Flt/Int : Auxiliary arrays (see Src_SetAuxArray_ExactCooling())
+//                knew             : Power-law interval where Ynew resides
+//
+// Return      :  New temperature, knew
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+double Src_ExactCooling_NewTemp( const double Ynew, const int k, const double TEF_alpha[], const double TEFc[],
+                                 const double TEF_Coeff[], const double AuxArray_Flt[], const int AuxArray_Int[],
+                                 int *knew )
+{
+
+   const double TEF_Tmin   = AuxArray_Flt[2];   // MIN temperature 
+
+   *knew = Src_ExactCooling_NewInterval( Ynew, k, TEFc, AuxArray_Int );
+
+   if ( *knew >= 0 )
+      return TEFinv( Ynew, *knew, TEF_alpha, TEFc, TEF_Coeff );
+   else {
+      *knew = 0;  
+      return TEF_Tmin; // reached the floor: Tn+1 < Tfloor
+   }
+
+} // FUNCTION : Src_ExactCooling_NewTemp
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_NewInterval
+// Description :  Find the power-law interval where Ynew resides
+//
+// Note        :  1. Invoked by Src_ExactCooling_NewTemp() and Src_ExactCooling_NewInterval_Patch()
+//                2. Return -1 if the temperature falls below the floor
+//
+// Parameter   :  Ynew         : TEF value after cooling
+//                k            : Power-law interval of the initial temperature
+//                TEFc         : TEF values at the lower bound of each interval
+//                AuxArray_Int : Integer auxiliary array (see Src_SetAuxArray_ExactCooling())
+//
+// Return      :  Power-law interval where Ynew resides
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+int Src_ExactCooling_NewInterval( const double Ynew, const int k, const double TEFc[], const int AuxArray_Int[] )
+{
+
+   const bool TEF_Search = AuxArray_Int[1];   // search the interval of Ynew by bisection instead of a linear scan
+
+// find the largest i <= k satisfying Ynew < TEFc[i]
+// --> TEF_SearchInterval() returns exactly the same interval as the linear scan when TEFc[] is
+//     strictly decreasing, which is validated in Src_Init_ExactCooling()
+   if ( TEF_Search )
+      return TEF_SearchInterval( Ynew, k, TEFc );
+
+   for (int i=k; i>=0; i--)
+      if ( Ynew < TEFc[i] )   return i;
+
+   return -1;
+
+} // FUNCTION : Src_ExactCooling_NewInterval
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_ZWeight
+// Description :  Find the two TEF tables bracketing the metallicity of a cell and the interpolation weight
+//
+// Note        :  1. Invoked by Src_ExactCooling() and CPU_SrcSolver_ExactCooling() when TEF_NZ > 1
+//                2. Metallicity Z = Metal/Dens, where Metal is the passive field Idx_Metal
+//                3. The TEF tables are sampled linearly in [SRC_EC_ZMIN, SRC_EC_ZMAX]
+//                   --> Z is clamped to this range
+//                4. Branch-free so that it can be vectorized
+//
+// Parameter   :  Dens             : Gas mass density
+//                Metal            : Metal mass density
+//                AuxArray_Flt/Int : Auxiliary arrays (see Src_SetAuxArray_ExactCooling())
+//                z0               : Index of the lower TEF table (the upper one is z0+1)
+//
+// Return      :  Weight of the upper TEF table, z0
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+double Src_ExactCooling_ZWeight( const real Dens, const real Metal, const double AuxArray_Flt[], const int AuxArray_Int[],
+                                 int *z0 )
+{
+
+   const int    TEF_NZ   = AuxArray_Int[2];   // number of TEF tables sampled in metallicity
+   const double TEF_ZMin = AuxArray_Flt[10];  // metallicity of the first TEF table
+   const double TEF__dZ  = AuxArray_Flt[11];  // 1/(metallicity spacing of the TEF tables)
+
+// clamp with select instead of fmin/fmax(), which are not inlined without -ffast-math
+// --> NaN is mapped to zero as fmax()
+   double zf = ( (double)Metal/(double)Dens - TEF_ZMin )*TEF__dZ;
+   zf  = ( zf > 0.0                   ) ? zf : 0.0;
+   zf  = ( zf < (double)(TEF_NZ-1)    ) ? zf : (double)(TEF_NZ-1);
+   *z0 = (int)zf;
+   *z0 = ( *z0 < TEF_NZ-2 ) ? *z0 : TEF_NZ-2;
+
+   return zf - (*z0);
+
+} // FUNCTION : Src_ExactCooling_ZWeight
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  TEF
+// Description :  Temporal evolution function (TEF) Y(T) in the power-law interval k
+//
+// Note        :  1. Integration in Gaspari (2009) Eq. (24)
+//                2. Use the precomputed per-interval coefficients in TEF_Coeff[] and the cooling rate
+//                   lambdaTEMP = lambda(TEMP) already computed by the caller to avoid any additional
+//                   transcendental function
+//                   --> (Tk/TEMP)^(alpha_k-1) = (TEMP/Tk)*(lambda_k/lambdaTEMP)
+//
+// Parameter   :  TEMP       : Temperature
+//                k          : Power-law interval where TEMP resides
+//                lambdaTEMP : lambda(TEMP)
+//                TEF_*      : TEF tables
+//
+// Return      :  Y(TEMP)
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+double TEF( const double TEMP, const int k, const double lambdaTEMP, const double TEF_lambda[], const double TEF_alpha[],
+            const double TEFc[], const double TEF_Coeff[] )
+{
+
+   const double *Coeff = TEF_Coeff + k*SRC_EC_TEF_NCOEFF;
+   const double  Tk    = Coeff[SRC_EC_TEF_TK];
+
+   double TEF;
+   if ( TEF_alpha[k] != 1.0 )
+      TEF = TEFc[k] + Coeff[SRC_EC_TEF_FWD]*( 1.0 - (TEMP/Tk)*(TEF_lambda[k]/lambdaTEMP) );
+   else
+      TEF = TEFc[k] + Coeff[SRC_EC_TEF_FWD]*log(Tk/TEMP);
+
    return TEF;
-}
+
+} // FUNCTION : TEF
 
 
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  TEFinv
+// Description :  Inverse temporal evolution function (TEF^-1) in the power-law interval k
+//
+// Note        :  1. Use the precomputed per-interval coefficients in TEF_Coeff[]
+//
+// Parameter   :  Y     : Value of the TEF
+//                k     : Power-law interval where Y resides
+//                TEF_* : TEF tables
+//
+// Return      :  Temperature T satisfying Y(T) = Y
+//-------------------------------------------------------------------------------------------------------
 GPU_DEVICE static
-// the INVERSE temporal evolution function (TEF^-1)
-double TEFinv( double Y, int k, const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
-               const double AuxArray_Flt[], const int AuxArray_Int[] ){
+double TEFinv( const double Y, const int k, const double TEF_alpha[], const double TEFc[], const double TEF_Coeff[] )
+{
+
+   const double *Coeff = TEF_Coeff + k*SRC_EC_TEF_NCOEFF;
+   const double  Tk    = Coeff[SRC_EC_TEF_TK];
+   const double  dY    = Y - TEFc[k];
+
+   double TEFinv;
+   if ( TEF_alpha[k] != 1.0 )
+      TEFinv = Tk*POW( 1.0 - Coeff[SRC_EC_TEF_INV]*dY, Coeff[SRC_EC_TEF_EXP] );
+   else
+      TEFinv = Tk*exp( -Coeff[SRC_EC_TEF_INV]*dY );
+
+   return TEFinv;
+
+} // FUNCTION : TEFinv
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  TEF_SearchInterval
+// Description :  Find the power-law interval where Y resides
+//
+// Note        :  1. Return the largest i in [0,k] satisfying Y < TEFc[i], or -1 if there is none
+//                   (i.e., Y has reached the temperature floor)
+//                2. TEFc[] must be strictly decreasing so that "Y < TEFc[i]" holds for all i below the target
+//                   interval and fails for all i above it
+//                3. Gallop downward from k to bracket the target interval and then apply a branch-free bisection
+//                   --> O(1) for the most common case (Y stays in interval k) and O(log(k-knew)) in general
+//
+// Parameter   :  Y    : Value of the TEF
+//                k    : Interval of the initial temperature (i.e., the upper bound of the target interval)
+//                TEFc : TEF values at the lower bound of each interval
+//
+// Return      :  Target interval
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+int TEF_SearchInterval( const double Y, const int k, const double TEFc[] )
+{
+
+   if ( Y < TEFc[k] )   return k;
+
+// (1) gallop downward until "Y < TEFc[lo]" holds --> the target interval is in [lo, hi-1]
+   int hi   = k;
+   int lo   = k - 1;
+   int step = 1;
+
+   while ( lo >= 0  &&  !( Y < TEFc[lo] ) )
+   {
+      hi    = lo;
+      step *= 2;
+      lo    = hi - step;
+   }
+
+   if ( lo < 0 )
+   {
+      if (  !( Y < TEFc[0] )  )   return -1;
+      lo = 0;
+   }
+
+// (2) branch-free bisection over the n = hi - lo candidates with "Y < TEFc[base]" always holding
+   int base = lo;
+   int n    = hi - lo;
+
+   while ( n > 1 )
+   {
+      const int half = n / 2;
+      base = ( Y < TEFc[base+half] ) ? base + half : base;
+      n   -= half;
+   }
+
+   return base;
+
+} // FUNCTION : TEF_SearchInterval
+
+
+
+#ifndef GPU
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_Exp/Log
+// Description :  Vectorizable exp() and log() in double precision
+//
+// Note        :  1. Invoked by the helper functions of CPU_SrcSolver_ExactCooling()
+//                2. Branch-free and free of any library call so that the compiler can vectorize the loops
+//                   calling them without a vector math library
+//                   --> Bit manipulations go through memcpy() and only use 64-bit integer shifts and masks
+//                3. Same algorithms as exp() and log() in fdlibm
+//                   --> exp(): x = n*ln(2) + r with |r| <= 0.5*ln(2) and a rational approximation of exp(r)
+//                       log(): x = 2^n*(1+f) with sqrt(1/2) <= 1+f < sqrt(2) and a polynomial in s = f/(2+f)
+//                   --> Maximum error is about 1 ulp
+//                4. Src_ExactCooling_Exp() clamps x to [-708, 709]
+//                   Src_ExactCooling_Log() requires a positive normal number
+//
+// Parameter   :  x : Input value
+//
+// Return      :  exp(x), log(x)
+//-------------------------------------------------------------------------------------------------------
+static inline double Src_ExactCooling_Exp( const double x )
+{
+
+   const double Log2e  =  1.44269504088896338700e+00;
+   const double Ln2_Hi =  6.93147180369123816490e-01;
+   const double Ln2_Lo =  1.90821492927058770002e-10;
+   const double P1     =  1.66666666666666019037e-01;
+   const double P2     = -2.77777777770155933842e-03;
+   const double P3     =  6.61375632143793436117e-05;
+   const double P4     = -1.65339022054652515390e-06;
+   const double P5     =  4.13813679705723846039e-08;
+   const double Two52  =  4503599627370496.0;   // 2^52
+
+// x = n*ln(2) + r
+// --> add an offset before the conversion so that truncation rounds n to the nearest integer
+   const double xc = ( x < -708.0 ) ? -708.0 : ( x > 709.0 ) ? 709.0 : x;
+   const double n  = (double)(  (int)( xc*Log2e + 1024.5 ) - 1024  );
+   const double Hi = xc - n*Ln2_Hi;
+   const double Lo = n*Ln2_Lo;
+   const double r  = Hi - Lo;
+   const double r2 = r*r;
+   const double c  = r - r2*( P1 + r2*( P2 + r2*( P3 + r2*( P4 + r2*P5 ) ) ) );
+   const double y  = 1.0 - (  ( Lo - (r*c)/(2.0-c) ) - Hi  );
+
+// 2^n --> the biased exponent n+1023 is stored in the lowest bits of n+1023+2^52
+   const double Biased = n + 1023.0 + Two52;
+   ulong  Bits;
+   double Scale;
+
+   memcpy( &Bits,  &Biased, sizeof(double) );
+   Bits <<= 52;
+   memcpy( &Scale, &Bits,   sizeof(double) );
+
+   return y*Scale;
+
+} // FUNCTION : Src_ExactCooling_Exp
+
+
+
+static inline double Src_ExactCooling_Log( const double x )
+{
+
+   const double Ln2_Hi   = 6.93147180369123816490e-01;
+   const double Ln2_Lo   = 1.90821492927058770002e-10;
+   const double Lg1      = 6.666666666666735130e-01;
+   const double Lg2      = 3.999999999940941908e-01;
+   const double Lg3      = 2.857142874366239149e-01;
+   const double Lg4      = 2.222219843214978396e-01;
+   const double Lg5      = 1.818357216161805012e-01;
+   const double Lg6      = 1.531383769920937332e-01;
+   const double Lg7      = 1.479819860511658591e-01;
+   const double Two52    = 4503599627370496.0;   // 2^52
+   const ulong  One      = 0x3ff0000000000000UL;   // bit pattern of 1.0
+   const ulong  SqrtHalf = 0x3fe6a09e667f3bcdUL;   // bit pattern of sqrt(1/2)
+
+// x = 2^n*(1+f)
+// --> shift the bit pattern by 1-sqrt(1/2) so that the exponent field gives n for 1+f in [sqrt(1/2), sqrt(2))
+// --> get n as a double by storing the biased exponent in the lowest bits of 2^52
+   ulong  Bits, BitsN;
+   double n, m;
+
+   memcpy( &Bits, &x, sizeof(double) );
+   Bits += One - SqrtHalf;
+   BitsN = ( Bits >> 52 ) | 0x4330000000000000UL;
+   memcpy( &n, &BitsN, sizeof(double) );
+   n    -= Two52 + 1023.0;
+   Bits  = ( Bits & 0x000fffffffffffffUL ) + SqrtHalf;
+   memcpy( &m, &Bits, sizeof(double) );
+
+// log(1+f) = f - f^2/2 + s*(f^2/2+R(s^2))
+   const double f    = m - 1.0;
+   const double hfsq = 0.5*f*f;
+   const double s    = f/(2.0+f);
+   const double z    = s*s;
+   const double w    = z*z;
+   const double R    = z*( Lg1 + w*( Lg3 + w*( Lg5 + w*Lg7 ) ) ) + w*( Lg2 + w*( Lg4 + w*Lg6 ) );
+
+   return n*Ln2_Hi - (  ( hfsq - ( s*(hfsq+R) + n*Ln2_Lo ) ) - f  );
+
+} // FUNCTION : Src_ExactCooling_Log
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_ExpF/LogF
+// Description :  Single-precision versions of Src_ExactCooling_Exp/Log()
+//
+// Note        :  1. Invoked through EC_EXP() and EC_LOG() by the mixed-precision helper functions of
+//                   CPU_SrcSolver_ExactCooling() when FLOAT8 is off
+//                2. Same algorithms as expf() and logf() in fdlibm
+//                   --> Maximum error is about 1.5 ulp
+//                3. Src_ExactCooling_ExpF() clamps x to [-87, 88]
+//                   Src_ExactCooling_LogF() requires a positive normal number
+//
+// Parameter   :  x : Input value
+//
+// Return      :  expf(x), logf(x)
+//-------------------------------------------------------------------------------------------------------
+static inline float Src_ExactCooling_ExpF( const float x )
+{
+
+   const float Log2e  =  1.4426950216e+00f;
+   const float Ln2_Hi =  6.9314575195e-01f;
+   const float Ln2_Lo =  1.4286067653e-06f;
+   const float P1     =  1.6666625440e-01f;
+   const float P2     = -2.7667332906e-03f;
+   const float Two23  =  8388608.0f;   // 2^23
+
+   const float xc = ( x < -87.0f ) ? -87.0f : ( x > 88.0f ) ? 88.0f : x;
+   const float n  = (float)(  (int)( xc*Log2e + 128.5f ) - 128  );
+   const float Hi = xc - n*Ln2_Hi;
+   const float Lo = n*Ln2_Lo;
+   const float r  = Hi - Lo;
+   const float r2 = r*r;
+   const float c  = r - r2*( P1 + r2*P2 );
+   const float y  = 1.0f - (  ( Lo - (r*c)/(2.0f-c) ) - Hi  );
+
+   const float Biased = n + 127.0f + Two23;
+   uint  Bits;
+   float Scale;
+
+   memcpy( &Bits,  &Biased, sizeof(float) );
+   Bits <<= 23;
+   memcpy( &Scale, &Bits,   sizeof(float) );
+
+   return y*Scale;
+
+} // FUNCTION : Src_ExactCooling_ExpF
+
+
+
+static inline float Src_ExactCooling_LogF( const float x )
+{
+
+   const float Ln2_Hi   = 6.9313812256e-01f;
+   const float Ln2_Lo   = 9.0580006145e-06f;
+   const float Lg1      = 6.6666662693e-01f;
+   const float Lg2      = 4.0000972152e-01f;
+   const float Lg3      = 2.8498786688e-01f;
+   const float Lg4      = 2.4279078841e-01f;
+   const float Two23    = 8388608.0f;   // 2^23
+   const uint  One      = 0x3f800000U;   // bit pattern of 1.0f
+   const uint  SqrtHalf = 0x3f3504f3U;   // bit pattern of sqrt(1/2)
+
+   uint  Bits, BitsN;
+   float n, m;
+
+   memcpy( &Bits, &x, sizeof(float) );
+   Bits += One - SqrtHalf;
+   BitsN = ( Bits >> 23 ) | 0x4b000000U;
+   memcpy( &n, &BitsN, sizeof(float) );
+   n    -= Two23 + 127.0f;
+   Bits  = ( Bits & 0x007fffffU ) + SqrtHalf;
+   memcpy( &m, &Bits, sizeof(float) );
+
+   const float f    = m - 1.0f;
+   const float hfsq = 0.5f*f*f;
+   const float s    = f/(2.0f+f);
+   const float z    = s*s;
+   const float w    = z*z;
+   const float R    = z*( Lg1 + w*Lg3 ) + w*( Lg2 + w*Lg4 );
+
+   return n*Ln2_Hi - (  ( hfsq - ( s*(hfsq+R) + n*Ln2_Lo ) ) - f  );
+
+} // FUNCTION : Src_ExactCooling_LogF
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_Ynew_Vec
+// Description :  Vectorizable version of Src_ExactCooling_Ynew()
+//
+// Note        :  1. Invoked by CPU_SrcSolver_ExactCooling()
+//                2. Replace log10() and POW() by Src_ExactCooling_Log/Exp() and select between the two cases of
+//                   TEF() instead of branching
+//                   --> POW() is single precision when FLOAT8 is off, so this function is more accurate than
+//                       Src_ExactCooling_Ynew() but does not reproduce it bit by bit
+//                3. Clamp Tini to TEF_TN so that k stays in the tables
+//                   --> Do not clamp k itself since selecting a table offset prevents the vectorization
+//
+// Parameter   :  See Src_ExactCooling_Ynew()
+//
+// Return      :  Ynew, k, tcool
+//-------------------------------------------------------------------------------------------------------
+static inline double Src_ExactCooling_Ynew_Vec( const double Tini, const real Dens, const real dt,
+                                                const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
+                                                const double TEF_Coeff[], const double AuxArray_Flt[],
+                                                const int AuxArray_Int[], int *k, double *tcool )
+{
 
    const int    TEF_N      = AuxArray_Int[0];   // number of points for lambda(T) sampling in LOG
+   const double cl_CV      = AuxArray_Flt[0];   // 1.0/(GAMMA-1.0)
    const double TEF_TN     = AuxArray_Flt[1];   // == Tref, high enough, but affects sampling resolution
-   const double TEF_Tmin   = AuxArray_Flt[2];   // MIN temperature 
    const double TEF_dltemp = AuxArray_Flt[3];   // sampling resolution (Kelvin), LOG!
+   const double TEF_lTmin  = AuxArray_Flt[9];   // log10(TEF_Tmin)
 
-   double TEFinv, Tk, Yk;
-   Tk = POW(10.0, log10(TEF_Tmin) + k*TEF_dltemp); 
-   Yk = TEFc[k]; 
- 
-   if ( TEF_alpha[k] != 1.0 ){
-      TEFinv = Tk*POW(1.0-(1.0-TEF_alpha[k])*(TEF_lambda[k]/TEF_lambda[TEF_N-1])*(TEF_TN/Tk)*(double(Y)-Yk), 1.0/(1.0-TEF_alpha[k]));
-   } 
-   else   TEFinv = Tk * exp(-((TEF_lambda[k]/TEF_lambda[TEF_N-1]) * (TEF_TN/Tk) * (double(Y)-Yk)));
+// (1) decide the interval k where Tini falls into and get lambda(Tini) = lambda_k*(Tini/Tk)^alpha_k
+   const double T = ( Tini < TEF_TN ) ? Tini : TEF_TN;
 
-   return TEFinv;
-}
+   *k = int( (Src_ExactCooling_Log(T)*M_LOG10E - TEF_lTmin)/TEF_dltemp );
+
+   const int     kc      = (*k)*SRC_EC_TEF_NCOEFF;
+   const double  Tk      = TEF_Coeff[ kc + SRC_EC_TEF_TK  ];
+   const double  Fwd     = TEF_Coeff[ kc + SRC_EC_TEF_FWD ];
+   const double  lambdak = TEF_lambda[*k];
+   const double  alpha   = TEF_alpha[*k];
+   const double  lnT_Tk  = Src_ExactCooling_Log( T/Tk );
+   const double  lambdaT = lambdak*Src_ExactCooling_Exp( alpha*lnT_Tk );
+
+// (2) compute the cooling time
+   *tcool = cl_CV*T/(Dens*lambdaT);
+
+// (3) calculate Ynew
+// --> same as TEF() with log(Tk/T) = -lnT_Tk
+// --> load all table entries unconditionally since masked gathers are not supported by all instruction sets
+   const double dY = ( alpha != 1.0 ) ? Fwd*( 1.0 - (T/Tk)*(lambdak/lambdaT) ) : -Fwd*lnT_Tk;
+
+   return TEFc[*k] + dY + (T/TEF_TN)*(TEF_lambda[TEF_N-1]/lambdaT)*(dt/(*tcool));
+
+} // FUNCTION : Src_ExactCooling_Ynew_Vec
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_TEFinv_Vec
+// Description :  Vectorizable version of TEFinv() including the temperature floor
+//
+// Note        :  1. Invoked by CPU_SrcSolver_ExactCooling()
+//                2. Return TEF_Tmin if knew < 0 (i.e., the temperature falls below the floor)
+//                3. Replace POW() and exp() by Src_ExactCooling_Log/Exp() and select between the two cases of
+//                   TEFinv() instead of branching
+//
+// Parameter   :  Y                : TEF value after cooling
+//                knew             : Power-law interval where Y resides returned by Src_ExactCooling_NewInterval()
+//                TEF_*            : TEF tables
+//                AuxArray_Flt     : Floating-point auxiliary array (see Src_SetAuxArray_ExactCooling())
+//
+// Return      :  New temperature
+//-------------------------------------------------------------------------------------------------------
+static inline double Src_ExactCooling_TEFinv_Vec( const double Y, const int knew, const double TEF_alpha[],
+                                                  const double TEFc[], const double TEF_Coeff[],
+                                                  const double AuxArray_Flt[] )
+{
+
+   const double  TEF_Tmin = AuxArray_Flt[2];   // MIN temperature
+   const int     kk       = MAX( knew, 0 );
+   const int     kc       = kk*SRC_EC_TEF_NCOEFF;
+   const double  Tk       = TEF_Coeff[ kc + SRC_EC_TEF_TK  ];
+   const double  Inv      = TEF_Coeff[ kc + SRC_EC_TEF_INV ];
+   const double  Exp      = TEF_Coeff[ kc + SRC_EC_TEF_EXP ];
+   const double  dY       = Y - TEFc[kk];
+   const bool    PowerLaw = ( TEF_alpha[kk] != 1.0 );
+
+// Tk*(1-INV*dY)^EXP for alpha_k != 1 and Tk*exp(-INV*dY) for alpha_k == 1
+// --> load all table entries unconditionally as in Src_ExactCooling_Ynew_Vec()
+   const double  Base     = ( PowerLaw ) ? 1.0 - Inv*dY : 1.0;
+   const double  Arg      = ( PowerLaw ) ? Exp*Src_ExactCooling_Log( Base ) : -Inv*dY;
+   const double  Temp     = Tk*Src_ExactCooling_Exp( Arg );
+
+   return ( knew < 0 ) ? TEF_Tmin : Temp;
+
+} // FUNCTION : Src_ExactCooling_TEFinv_Vec
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_Ynew_Mixed
+// Description :  Mixed-precision version of Src_ExactCooling_Ynew_Vec()
+//
+// Note        :  1. Invoked by CPU_SrcSolver_ExactCooling() when SRC_EC_MIXED_PRECISION is on
+//                2. The table lookup, power-law evaluation, and cooling time are computed in real, which is
+//                   single precision when FLOAT8 is off
+//                   --> Use the single-precision per-interval data in TEF_Mixed[] and EC_LOG/EXP()
+//                3. Only the accumulation Ynew = TEFc[k] + dY(Tini) + dY(dt) is done in double precision since
+//                   TEFc[k] is much larger than the increments for low temperatures
+//                4. Clamp Tini to TEF_TN so that k stays in the tables even if the single-precision logarithm
+//                   slightly exceeds the table range
+//                5. Take the offset t0 of the TEF table instead of a shifted TEF_Mixed pointer
+//                   --> Emulated gathers of float elements only support 32-bit offsets from an invariant base
+//
+// Parameter   :  Tini             : Initial temperature
+//                Dens             : Gas mass density
+//                dt               : Time interval to advance solution
+//                t0               : Offset of the TEF table (i.e., z0*TEF_N)
+//                TEF_Mixed        : Single-precision per-interval data (see Src_Init_ExactCooling())
+//                TEFc             : TEF values at the lower bound of each interval
+//                AuxArray_Flt/Int : Auxiliary arrays (see Src_SetAuxArray_ExactCooling())
+//                k                : Power-law interval where Tini resides
+//                tcool            : Cooling time
+//
+// Return      :  Ynew, k, tcool
+//-------------------------------------------------------------------------------------------------------
+static inline double Src_ExactCooling_Ynew_Mixed( const real Tini, const real Dens, const real dt, const int t0,
+                                                  const real TEF_Mixed[], const double TEFc[], const double AuxArray_Flt[],
+                                                  const int AuxArray_Int[], int *k, double *tcool )
+{
+
+   const int  TEF_N      = AuxArray_Int[0];                               // number of points for lambda(T) sampling in LOG
+   const real cl_CV      = (real)AuxArray_Flt[0];                         // 1.0/(GAMMA-1.0)
+   const real TEF_TN     = (real)AuxArray_Flt[1];                         // Tref
+   const real TEF__TN    = (real)( 1.0/AuxArray_Flt[1] );                 // 1/Tref
+   const real TEF_lnTmin = (real)( AuxArray_Flt[9]*M_LN10 );              // ln(TEF_Tmin)
+   const real TEF__dlnT  = (real)( 1.0/(AuxArray_Flt[3]*M_LN10) );        // 1/(sampling resolution in ln(T))
+
+// (1) decide the interval k where Tini falls into
+   const real T = ( Tini < TEF_TN ) ? Tini : TEF_TN;
+
+   *k = int( (EC_LOG(T)-TEF_lnTmin)*TEF__dlnT );
+
+   const int   km         = ( t0 + *k )*SRC_EC_MIX_NVAR;
+   const real  Tk         = TEF_Mixed[ km + SRC_EC_MIX_TK     ];
+   const real  lambdak    = TEF_Mixed[ km + SRC_EC_MIX_LAMBDA ];
+   const real  alpha      = TEF_Mixed[ km + SRC_EC_MIX_ALPHA  ];
+   const real  Fwd        = TEF_Mixed[ km + SRC_EC_MIX_FWD    ];
+   const real  lambdaN    = TEF_Mixed[ (t0+TEF_N-1)*SRC_EC_MIX_NVAR + SRC_EC_MIX_LAMBDA ];
+   const real  lnT_Tk     = EC_LOG( T/Tk );
+   const real  lambdaTini = lambdak*EC_EXP( alpha*lnT_Tk );
+
+// (2) compute the cooling time
+   const real tc = cl_CV*T/(Dens*lambdaTini);
+   *tcool = tc;
+
+// (3) calculate Ynew
+// --> same as TEF() but without TEFc[k]
+   const real dY_Tini = ( alpha != (real)1.0 ) ? Fwd*( (real)1.0 - (T/Tk)*(lambdak/lambdaTini) ) : -Fwd*lnT_Tk;
+   const real dY_dt   = (T*TEF__TN)*(lambdaN/lambdaTini)*(dt/tc);
+
+   return TEFc[ t0 + *k ] + (double)dY_Tini + (double)dY_dt;
+
+} // FUNCTION : Src_ExactCooling_Ynew_Mixed
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_TEFinv_Mixed
+// Description :  Mixed-precision version of Src_ExactCooling_TEFinv_Vec()
+//
+// Note        :  1. Invoked by CPU_SrcSolver_ExactCooling() when SRC_EC_MIXED_PRECISION is on
+//                2. Compute Y-TEFc[knew] in double precision and then evaluate TEFinv() in real
+//                3. Take the offset t0 of the TEF table for the same reason as Src_ExactCooling_Ynew_Mixed()
+//
+// Parameter   :  Y                : TEF value after cooling
+//                knew             : Power-law interval where Y resides returned by Src_ExactCooling_NewInterval()
+//                t0               : Offset of the TEF table (i.e., z0*TEF_N)
+//                TEF_Mixed        : Single-precision per-interval data (see Src_Init_ExactCooling())
+//                TEFc             : TEF values at the lower bound of each interval
+//                AuxArray_Flt     : Floating-point auxiliary array (see Src_SetAuxArray_ExactCooling())
+//
+// Return      :  New temperature
+//-------------------------------------------------------------------------------------------------------
+static inline real Src_ExactCooling_TEFinv_Mixed( const double Y, const int knew, const int t0, const real TEF_Mixed[],
+                                                  const double TEFc[], const double AuxArray_Flt[] )
+{
+
+   const real  TEF_Tmin = (real)AuxArray_Flt[2];   // MIN temperature
+   const int   kk       = MAX( knew, 0 );
+   const int   km       = ( t0 + kk )*SRC_EC_MIX_NVAR;
+   const real  Tk       = TEF_Mixed[ km + SRC_EC_MIX_TK  ];
+   const real  Inv      = TEF_Mixed[ km + SRC_EC_MIX_INV ];
+   const real  Exp      = TEF_Mixed[ km + SRC_EC_MIX_EXP ];
+   const real  dY       = (real)( Y - TEFc[ t0 + kk ] );
+   const bool  PowerLaw = ( TEF_Mixed[ km + SRC_EC_MIX_ALPHA ] != (real)1.0 );
+
+   const real  Base     = ( PowerLaw ) ? (real)1.0 - Inv*dY : (real)1.0;
+   const real  Arg      = ( PowerLaw ) ? Exp*EC_LOG( Base ) : -Inv*dY;
+   const real  Temp     = Tk*EC_EXP( Arg );
+
+   return ( knew < 0 ) ? TEF_Tmin : Temp;
+
+} // FUNCTION : Src_ExactCooling_TEFinv_Mixed
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ExactCooling_NewInterval_Patch
+// Description :  Find the power-law intervals of Ynew for all cells in a patch
+//
+// Note        :  1. Invoked by CPU_SrcSolver_ExactCooling()
+//                2. First check the most common case that Ynew stays in the initial interval k in a vectorized
+//                   loop and then call Src_ExactCooling_NewInterval() only for the remaining cells
+//                   --> Same results as calling Src_ExactCooling_NewInterval() for all cells
+//
+// Parameter   :  Ynew         : TEF values after cooling
+//                k            : Power-law intervals of the initial temperature
+//                t0           : Offset of the TEF table of each cell (i.e., the table z0 starts at TEFc+t0)
+//                TEFc         : TEF values at the lower bound of each interval
+//                AuxArray_Int : Integer auxiliary array (see Src_SetAuxArray_ExactCooling())
+//                knew         : Power-law intervals where Ynew resides
+//
+// Return      :  knew[]
+//-------------------------------------------------------------------------------------------------------
+static void Src_ExactCooling_NewInterval_Patch( const double Ynew[], const int k[], const int t0[], const double TEFc[],
+                                                const int AuxArray_Int[], int knew[] )
+{
+
+   int NSearch = 0;
+
+#  pragma omp simd reduction( +:NSearch )
+   for (int idx=0; idx<CUBE(PS1); idx++)
+   {
+      const bool Stay = ( Ynew[idx] < TEFc[ t0[idx] + k[idx] ] );
+
+      knew[idx] = ( Stay ) ? k[idx] : -2;
+      NSearch  += !Stay;
+   }
+
+   if ( NSearch > 0 )
+   for (int idx=0; idx<CUBE(PS1); idx++)
+      if ( knew[idx] == -2 )  knew[idx] = Src_ExactCooling_NewInterval( Ynew[idx], k[idx], TEFc+t0[idx], AuxArray_Int );
+
+} // FUNCTION : Src_ExactCooling_NewInterval_Patch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_SrcSolver_ExactCooling
+// Description :  Batched CPU solver for the exact cooling
+//
+// Note        :  1. Invoked by CPU_SrcSolver() when the exact cooling is the only enabled source term
+//                   --> Replace CPU_SrcSolver_IterateAllCells(), which calls Src_ExactCooling() cell by cell
+//                       through the source-term and EoS function pointers
+//                2. Update all cells in a patch together and split Src_ExactCooling() into several loops
+//                   over the structure-of-arrays g_Flu_Array_Out[p][v][idx]
+//                   --> The branches on TEF_NZ and SRC_EC_MIXED_PRECISION are hoisted out of the loops
+//                   --> The loops only call the inline helpers Src_ExactCooling_*_Vec/Mixed(), which evaluate
+//                       the transcendental functions with Src_ExactCooling_Exp/Log() and select instead of
+//                       branching, so that the compiler can vectorize them without a vector math library
+//                   --> Only the cells whose Ynew leaves the initial power-law interval search the new interval
+//                       cell by cell
+//                3. EoS conversions are hard-coded when EOS == EOS_GAMMA
+//                   --> Other EoS still go through the EoS function pointers cell by cell
+//                4. Do not reproduce Src_ExactCooling() bit by bit since Src_ExactCooling_Exp/Log() replace log10()
+//                   and POW()
+//                   --> Differences are at the level of the rounding of POW(), which is single precision when
+//                       FLOAT8 is off
+//                   --> Including the metallicity-dependent cooling with TEF_NZ > 1
+//                   --> The mixed-precision mode (SRC_EC_MIXED_PRECISION) is only supported here
+//                5. No ghost zones
+//
+// Parameter   :  g_Flu_Array_In    : Array storing the input fluid variables
+//                g_Flu_Array_Out   : Array to store the output fluid variables
+//                g_Mag_Array_In    : Array storing the input B field (for MHD only)
+//                SrcTerms          : Structure storing all source-term variables
+//                NPatchGroup       : Number of patch groups to be evaluated
+//                dt                : Time interval to advance solution
+//
+// Return      : g_Flu_Array_Out[]
+//-------------------------------------------------------------------------------------------------------
+void CPU_SrcSolver_ExactCooling( const real g_Flu_Array_In [][FLU_NIN_S ][ CUBE(SRC_NXT)           ],
+                                       real g_Flu_Array_Out[][FLU_NOUT_S][ CUBE(PS1)               ],
+                                 const real g_Mag_Array_In [][NCOMP_MAG ][ SRC_NXT_P1*SQR(SRC_NXT) ],
+                                 const SrcTerms_t SrcTerms, const int NPatchGroup, const real dt )
+{
+
+   const double *AuxArray_Flt = SrcTerms.EC_AuxArrayDevPtr_Flt;
+   const int    *AuxArray_Int = SrcTerms.EC_AuxArrayDevPtr_Int;
+   const double *TEF_lambda   = h_SrcEC_TEF_lambda;
+   const double *TEF_alpha    = h_SrcEC_TEF_alpha;
+   const double *TEFc         = h_SrcEC_TEFc;
+   const double *TEF_Coeff    = h_SrcEC_TEF_Coeff;
+   const real    TEF_Tmin     = (real)AuxArray_Flt[2];
+   const int     TEF_N        = AuxArray_Int[0];
+   const int     TEF_NZ       = AuxArray_Int[2];
+   const int     Idx_Z        = AuxArray_Int[3];
+   const bool    MixedPrecision = SrcTerms.EC_MixedPrecision;
+   const real   *TEF_Mixed      = h_SrcEC_TEF_Mixed;
+
+#  ifndef MHD
+   (void)g_Mag_Array_In;   // for MHD only
+#  endif
+
+#  if ( EOS == EOS_GAMMA )
+   const real Gamma_m1  = (real)EoS_AuxArray_Flt[1];
+   const real _Gamma_m1 = (real)EoS_AuxArray_Flt[2];
+   const real m_kB      = (real)EoS_AuxArray_Flt[4];
+   const real _m_kB     = (real)EoS_AuxArray_Flt[5];
+#  endif
+
+
+#  pragma omp parallel for schedule( runtime )
+   for (int p=0; p<8*NPatchGroup; p++)
+   {
+      const real *Dens = g_Flu_Array_Out[p][DENS];
+            real *Engy = g_Flu_Array_Out[p][ENGY];
+
+      double Tini[ CUBE(PS1) ], Eint[ CUBE(PS1) ], Ynew[ CUBE(PS1) ], tcool[ CUBE(PS1) ], Temp[ CUBE(PS1) ];
+      int    k[ CUBE(PS1) ], knew[ CUBE(PS1) ];
+
+//    t0 = z0*TEF_N is the offset of the TEF table z0 of each cell, which is zero for TEF_NZ == 1
+//    --> for TEF_NZ > 1 only: the suffix "1" denotes the upper TEF table z0+1
+      int    t0[ CUBE(PS1) ];
+      double wZ[ CUBE(PS1) ], Ynew1[ CUBE(PS1) ], tcool1[ CUBE(PS1) ];
+      int    k1[ CUBE(PS1) ], knew1[ CUBE(PS1) ];
+
+
+//    (1) copy the input data
+      for (int k_out=0; k_out<PS1; k_out++)
+      for (int j_out=0; j_out<PS1; j_out++)
+      {
+         const int idx_in0  = IDX321( SRC_GHOST_SIZE, SRC_GHOST_SIZE+j_out, SRC_GHOST_SIZE+k_out, SRC_NXT, SRC_NXT );
+         const int idx_out0 = IDX321( 0, j_out, k_out, PS1, PS1 );
+
+         for (int v=0; v<FLU_NOUT_S; v++)
+         for (int i=0; i<PS1; i++)  g_Flu_Array_Out[p][v][ idx_out0 + i ] = g_Flu_Array_In[p][v][ idx_in0 + i ];
+      }
+
+
+//    (2) get the initial temperature and internal energy
+//        --> magnetic energy to be subtracted when computing the internal energy
+#     ifdef MHD
+      real Emag[ CUBE(PS1) ];
+
+      for (int k_out=0; k_out<PS1; k_out++)
+      for (int j_out=0; j_out<PS1; j_out++)
+      for (int i_out=0; i_out<PS1; i_out++)
+      {
+         real B[NCOMP_MAG];
+         MHD_GetCellCenteredBField( B, g_Mag_Array_In[p][MAGX], g_Mag_Array_In[p][MAGY], g_Mag_Array_In[p][MAGZ],
+                                    SRC_NXT, SRC_NXT, SRC_NXT, SRC_GHOST_SIZE+i_out, SRC_GHOST_SIZE+j_out,
+                                    SRC_GHOST_SIZE+k_out );
+         Emag[ IDX321( i_out, j_out, k_out, PS1, PS1 ) ] = (real)0.5*( SQR(B[MAGX]) + SQR(B[MAGY]) + SQR(B[MAGZ]) );
+      }
+#     endif
+
+#     if ( EOS == EOS_GAMMA )
+//    same operations as Hydro_Con2Temp(), EoS_DensTemp2Pres_Gamma(), and EoS_DensPres2Eint_Gamma()
+//    --> the temperature floor does not apply to NaN as FMAX() in Hydro_Con2Temp()
+      const real *MomX = g_Flu_Array_Out[p][MOMX];
+      const real *MomY = g_Flu_Array_Out[p][MOMY];
+      const real *MomZ = g_Flu_Array_Out[p][MOMZ];
+
+#     pragma omp simd
+      for (int idx=0; idx<CUBE(PS1); idx++)
+      {
+         const real Rho = Dens[idx];
+         real Ein, T;
+
+         Ein  = Engy[idx] - (real)0.5*( SQR(MomX[idx]) + SQR(MomY[idx]) + SQR(MomZ[idx]) ) / Rho;
+#        ifdef MHD
+         Ein -= Emag[idx];
+#        endif
+         T    = m_kB*( Ein*Gamma_m1 ) / Rho;
+         T    = ( T < TEF_Tmin ) ? TEF_Tmin : T;
+
+         Tini[idx] = T;
+         Eint[idx] = ( T*Rho*_m_kB )*_Gamma_m1;
+      }
+
+#     else // #if ( EOS == EOS_GAMMA )
+      for (int idx=0; idx<CUBE(PS1); idx++)
+      {
+#        ifdef MHD
+         const real Emag_Cell = Emag[idx];
+#        else
+         const real Emag_Cell = (real)0.0;
+#        endif
+         real Passive[NCOMP_PASSIVE], Pres;
+
+         for (int v=0; v<NCOMP_PASSIVE; v++)  Passive[v] = g_Flu_Array_Out[p][ NCOMP_FLUID + v ][idx];
+
+         Tini[idx] = Hydro_Con2Temp( Dens[idx], g_Flu_Array_Out[p][MOMX][idx], g_Flu_Array_Out[p][MOMY][idx],
+                                     g_Flu_Array_Out[p][MOMZ][idx], Engy[idx], Passive,
+                                     true, TEF_Tmin, Emag_Cell, EoS_DensEint2Temp_CPUPtr,
+                                     EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+         Pres      = EOS_DENSTEMP2PRES( EoS_DensTemp2Pres_CPUPtr, Dens[idx], Tini[idx], NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+         Eint[idx] = EOS_DENSPRES2EINT( EoS_DensPres2Eint_CPUPtr, Dens[idx], Pres,      NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+      }
+#     endif // #if ( EOS == EOS_GAMMA ) ... else ...
+
+
+//    (3) compute the cooling time and Ynew
+//        --> for TEF_NZ > 1, integrate exactly with both TEF tables bracketing the metallicity of each cell
+//        --> for the mixed-precision mode, evaluate the TEF tables in single precision and accumulate Ynew in
+//            double precision
+      if ( TEF_NZ == 1 )
+      {
+         for (int idx=0; idx<CUBE(PS1); idx++)  t0[idx] = 0;
+
+         if ( MixedPrecision )
+         {
+#           pragma omp simd
+            for (int idx=0; idx<CUBE(PS1); idx++)
+               Ynew[idx] = Src_ExactCooling_Ynew_Mixed( Tini[idx], Dens[idx], dt, 0, TEF_Mixed, TEFc,
+                                                        AuxArray_Flt, AuxArray_Int, k+idx, tcool+idx );
+         }
+
+         else
+         {
+#           pragma omp simd
+            for (int idx=0; idx<CUBE(PS1); idx++)
+               Ynew[idx] = Src_ExactCooling_Ynew_Vec( Tini[idx], Dens[idx], dt, TEF_lambda, TEF_alpha, TEFc, TEF_Coeff,
+                                                      AuxArray_Flt, AuxArray_Int, k+idx, tcool+idx );
+         }
+      } // if ( TEF_NZ == 1 )
+
+      else
+      {
+         const real *Metal = g_Flu_Array_Out[p][Idx_Z];
+
+#        pragma omp simd
+         for (int idx=0; idx<CUBE(PS1); idx++)
+         {
+            int z0;
+            wZ[idx] = Src_ExactCooling_ZWeight( Dens[idx], Metal[idx], AuxArray_Flt, AuxArray_Int, &z0 );
+            t0[idx] = z0*TEF_N;
+         }
+
+         if ( MixedPrecision )
+         {
+#           pragma omp simd
+            for (int idx=0; idx<CUBE(PS1); idx++)
+            {
+               const int t1 = t0[idx] + TEF_N;
+
+               Ynew [idx] = Src_ExactCooling_Ynew_Mixed( Tini[idx], Dens[idx], dt, t0[idx], TEF_Mixed, TEFc,
+                                                         AuxArray_Flt, AuxArray_Int, k +idx, tcool +idx );
+               Ynew1[idx] = Src_ExactCooling_Ynew_Mixed( Tini[idx], Dens[idx], dt, t1,      TEF_Mixed, TEFc,
+                                                         AuxArray_Flt, AuxArray_Int, k1+idx, tcool1+idx );
+
+               tcool[idx] = 1.0/( (1.0-wZ[idx])/tcool[idx] + wZ[idx]/tcool1[idx] );
+            }
+         }
+
+         else
+         {
+#           pragma omp simd
+            for (int idx=0; idx<CUBE(PS1); idx++)
+            {
+               const int t1 = t0[idx] + TEF_N;
+
+               Ynew [idx] = Src_ExactCooling_Ynew_Vec( Tini[idx], Dens[idx], dt, TEF_lambda+t0[idx], TEF_alpha+t0[idx],
+                                                       TEFc+t0[idx], TEF_Coeff+t0[idx]*SRC_EC_TEF_NCOEFF,
+                                                       AuxArray_Flt, AuxArray_Int, k+idx, tcool+idx );
+               Ynew1[idx] = Src_ExactCooling_Ynew_Vec( Tini[idx], Dens[idx], dt, TEF_lambda+t1, TEF_alpha+t1,
+                                                       TEFc+t1, TEF_Coeff+t1*SRC_EC_TEF_NCOEFF,
+                                                       AuxArray_Flt, AuxArray_Int, k1+idx, tcool1+idx );
+
+               tcool[idx] = 1.0/( (1.0-wZ[idx])/tcool[idx] + wZ[idx]/tcool1[idx] );
+            }
+         }
+      } // if ( TEF_NZ == 1 ) ... else ...
+
+      for (int idx=0; idx<CUBE(PS1); idx++)  g_Flu_Array_Out[p][TCOOL][idx] = tcool[idx];
+
+
+//    (4) find the new power-law interval and compute the new temperature
+      Src_ExactCooling_NewInterval_Patch( Ynew, k, t0, TEFc, AuxArray_Int, knew );
+
+      if ( MixedPrecision )
+      {
+#        pragma omp simd
+         for (int idx=0; idx<CUBE(PS1); idx++)
+            Temp[idx] = Src_ExactCooling_TEFinv_Mixed( Ynew[idx], knew[idx], t0[idx], TEF_Mixed, TEFc, AuxArray_Flt );
+      }
+
+      else
+      {
+#        pragma omp simd
+         for (int idx=0; idx<CUBE(PS1); idx++)
+            Temp[idx] = Src_ExactCooling_TEFinv_Vec( Ynew[idx], knew[idx], TEF_alpha+t0[idx], TEFc+t0[idx],
+                                                     TEF_Coeff+t0[idx]*SRC_EC_TEF_NCOEFF, AuxArray_Flt );
+      }
+
+//    interpolate the new temperature linearly in Z
+      if ( TEF_NZ > 1 )
+      {
+         Src_ExactCooling_NewInterval_Patch( Ynew1, k1, t0, TEFc+TEF_N, AuxArray_Int, knew1 );
+
+         if ( MixedPrecision )
+         {
+#           pragma omp simd
+            for (int idx=0; idx<CUBE(PS1); idx++)
+            {
+               const int    t1    = t0[idx] + TEF_N;
+               const double Temp1 = Src_ExactCooling_TEFinv_Mixed( Ynew1[idx], knew1[idx], t1, TEF_Mixed, TEFc,
+                                                                   AuxArray_Flt );
+
+               Temp[idx] = (1.0-wZ[idx])*Temp[idx] + wZ[idx]*Temp1;
+            }
+         }
+
+         else
+         {
+#           pragma omp simd
+            for (int idx=0; idx<CUBE(PS1); idx++)
+            {
+               const int    t1    = t0[idx] + TEF_N;
+               const double Temp1 = Src_ExactCooling_TEFinv_Vec( Ynew1[idx], knew1[idx], TEF_alpha+t1, TEFc+t1,
+                                                                 TEF_Coeff+t1*SRC_EC_TEF_NCOEFF, AuxArray_Flt );
+
+               Temp[idx] = (1.0-wZ[idx])*Temp[idx] + wZ[idx]*Temp1;
+            }
+         }
+      } // if ( TEF_NZ > 1 )
+
+
+//    (5) calculate the new internal energy and update the total energy
+#     if ( EOS == EOS_GAMMA )
+#     pragma omp simd
+#     endif
+      for (int idx=0; idx<CUBE(PS1); idx++)
+      {
+         const double Enth = Engy[idx] - Eint[idx];
+         const real   T    = Temp[idx];
+         real Eintf;
+
+#        if ( EOS == EOS_GAMMA )
+         Eintf = ( T*Dens[idx]*_m_kB )*_Gamma_m1;
+#        else
+         const real Pres = EOS_DENSTEMP2PRES( EoS_DensTemp2Pres_CPUPtr, Dens[idx], T, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+         Eintf = EOS_DENSPRES2EINT( EoS_DensPres2Eint_CPUPtr, Dens[idx], Pres, NULL, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+#        endif
+
+         Engy[idx] = Enth + Eintf;
+
+#        ifdef GAMER_DEBUG
+         if (  Hydro_CheckUnphysical( UNPHY_MODE_SING, &Eintf, "output internal energy density", ERROR_INFO, UNPHY_VERBOSE )  )
+         {
+            printf( "Dens = %13.7e, Eint = %13.7e, Eintf = %13.7e, Engy = %13.7e\n", Dens[idx], Eint[idx], Eintf, Engy[idx] );
+            printf( "dt = %13.7e, Ynew = %13.7e, tcool = %13.7e, Temp = %13.7e\n", dt, Ynew[idx], tcool[idx], Temp[idx] );
+         }
+#        endif
+      }
+   } // for (int p=0; p<8*NPatchGroup; p++)
+
+} // FUNCTION : CPU_SrcSolver_ExactCooling
+#endif // #ifndef GPU
 
 
 
@@ -360,54 +1440,8 @@ double TEFinv( double Y, int k, const double TEF_lambda[], const double TEF_alph
 void Src_WorkBeforeMajorFunc_ExactCooling( const int lv, const double TimeNew, const double TimeOld, const double dt,
                                            double AuxArray_Flt[], int AuxArray_Int[] )
 {
-/*
-   if ( IsInit == true )   return;
 
-// Initialize the cooling function
-   const int    TEF_N        = AuxArray_Int[0];   // number of points for lambda(T) sampling in LOG
-   const int    TEF_int      = TEF_N-1;                  // number of intervals
-   const double TEF_TN       = AuxArray_Flt[1];   // == Tref, high enough, but affects sampling resolution
-   const double TEF_Tmin     = AuxArray_Flt[2];   // MIN temperature 
-   const double TEF_dltemp   = AuxArray_Flt[3];   // sampling resolution (Kelvin), LOG!
-   const double cl_Z         = AuxArray_Flt[4];   // metallicity (in Zsun)
-   const double cl_moli_mole = AuxArray_Flt[5];   // Assume the molecular weights are constant, mu_e*mu_i = 1.464 
-   const double cl_mol       = AuxArray_Flt[6];   // mean (total) molecular weights
-   const double cl_mp        = AuxArray_Flt[7];   // proton mass
-   const double cl_kB_mp     = AuxArray_Flt[8];   // Boltzmann constant in erg/K
- 
-   double emis, LAMBDAT, Ti, Tip1;
-// k = TEF_N-1
-   Cool_fct(1.0, TEF_TN, &emis, &LAMBDAT, cl_Z, cl_moli_mole, cl_mp);
-   h_SrcEC_TEF_lambda[TEF_N-1] = LAMBDAT*cl_mol/cl_moli_mole/cl_kB_mp;
-   h_SrcEC_TEF_alpha[TEF_N-1]  = 0.0;  //h_SrcEC_TEF_alpha[TEF_N-2];   // is never required >> just as N-2
-    
-   for (int i=TEF_N-2; i>=0; i--){
-      Ti   = POW(10, log10(TEF_Tmin) + i*TEF_dltemp);
-      Tip1 = POW(10, log10(TEF_Tmin) + (i+1)*TEF_dltemp);
-      Cool_fct(1.0, Ti, &emis, &LAMBDAT, cl_Z, cl_moli_mole, cl_mp);
-      h_SrcEC_TEF_lambda[i] = LAMBDAT*cl_mol/cl_moli_mole/cl_kB_mp;
-#     ifdef GAMER_DEBUG
-      if ( h_SrcEC_TEF_lambda[i] <= 0.0 ){
-         Aux_Error( ERROR_INFO, "h_SrcEC_TEF_lambda[i] invalid (can not be smaller or equal to zero)!!\n" );
-      }
-#     endif
-      h_SrcEC_TEF_alpha[i]  = (log10(h_SrcEC_TEF_lambda[i+1]) - log10(h_SrcEC_TEF_lambda[i])) / (log10(Tip1) - log10(Ti));
-//      if (i == TEF_N-2){
-//         printf("Debugging! i = %d, TEF_dltemp = %14.8e, TEF_Tmin = %14.8e, Ti = %14.8e, Tip1 = %14.8e, LAMBDAT = %14.8e, h_SrcEC_TEF_lambda[i] = %14.8e, h_SrcEC_TEF_alpha[i] = %14.8e\n", i, TEF_dltemp, TEF_Tmin, Ti, Tip1, LAMBDAT, h_SrcEC_TEF_lambda[i], h_SrcEC_TEF_alpha[i]);
-//      }
-   }
-    
-// Initialize the constant of intregration
-   double Ti_2, Tip1_2;
-   h_SrcEC_TEFc[TEF_N-1] = 0.0;   // TEF(Tref)
-   for (int i=TEF_N-2; i>=0; i--){
-      Ti_2   = POW(10.0, log10(TEF_Tmin) + i*TEF_dltemp);
-      Tip1_2 = POW(10.0, log10(TEF_Tmin) + (i+1)*TEF_dltemp);
-      if (h_SrcEC_TEF_alpha[i] != 1.0){
-         h_SrcEC_TEFc[i] = h_SrcEC_TEFc[i+1] - (1.0/(1.0-h_SrcEC_TEF_alpha[i]))*(h_SrcEC_TEF_lambda[TEF_N-1]/h_SrcEC_TEF_lambda[i])*(Ti_2/TEF_TN)*(1.0-POW(Ti_2/Tip1_2, h_SrcEC_TEF_alpha[i]-1.0));
-      } 
-      else   h_SrcEC_TEFc[i] = h_SrcEC_TEFc[i+1] - (h_SrcEC_TEF_lambda[TEF_N-1]/h_SrcEC_TEF_lambda[i])*(Ti_2/TEF_TN)*log(Ti_2/Tip1_2);
-   }
+// the TEF tables are built only once in Src_Init_ExactCooling()
 
 // uncomment the following lines if the auxiliary arrays have been modified
 //#  ifdef GPU
@@ -415,13 +1449,6 @@ void Src_WorkBeforeMajorFunc_ExactCooling( const int lv, const double TimeNew, c
 //                                    SrcTerms.EC_AuxArrayDevPtr_Flt, SrcTerms.EC_AuxArrayDevPtr_Int );
 //#  endif
 
-#  ifdef GPU
-   Src_PassData2GPU_ExactCooling();
-#  endif
-
-   IsInit = true; 
-//   printf( "Debugging!! Finish lambda initialization. h_SrcEC_TEF_lambda[TEF_N-2] = %14.8e.\n", h_SrcEC_TEF_lambda[TEF_N-2] );
-*/
 } // FUNCTION : Src_WorkBeforeMajorFunc_ExactCooling
 #endif
 
@@ -440,11 +1467,12 @@ void Src_WorkBeforeMajorFunc_ExactCooling( const int lv, const double TimeNew, c
 // -------------------------------------------------------------------------------------------------------
 void Src_PassData2GPU_ExactCooling()
 {
-   const long EC_TEF_MemSize = sizeof(double)*SrcTerms.EC_TEF_N; 
+   const long EC_TEF_MemSize = sizeof(double)*SrcTerms.EC_TEF_N*SrcTerms.EC_NZ;
 
    CUDA_CHECK_ERROR(  cudaMalloc( (void**) &d_SrcEC_TEF_lambda, EC_TEF_MemSize )  ); 
    CUDA_CHECK_ERROR(  cudaMalloc( (void**) &d_SrcEC_TEF_alpha,  EC_TEF_MemSize )  );  
    CUDA_CHECK_ERROR(  cudaMalloc( (void**) &d_SrcEC_TEFc,       EC_TEF_MemSize )  );  
+   CUDA_CHECK_ERROR(  cudaMalloc( (void**) &d_SrcEC_TEF_Coeff,  EC_TEF_MemSize*SRC_EC_TEF_NCOEFF )  );
 
 //   CUDA_CHECK_ERROR(  cudaMallocHost( (void**) &h_SrcEC_TEF_lambda, EC_TEF_MemSize  )  );        
 //   CUDA_CHECK_ERROR(  cudaMallocHost( (void**) &h_SrcEC_TEF_alpha,  EC_TEF_MemSize  )  );  
@@ -454,11 +1482,14 @@ void Src_PassData2GPU_ExactCooling()
    SrcTerms.EC_TEF_lambda_DevPtr = d_SrcEC_TEF_lambda;
    SrcTerms.EC_TEF_alpha_DevPtr  = d_SrcEC_TEF_alpha;
    SrcTerms.EC_TEFc_DevPtr       = d_SrcEC_TEFc;
+   SrcTerms.EC_TEF_Coeff_DevPtr  = d_SrcEC_TEF_Coeff;
 
 // use synchronous transfer
    CUDA_CHECK_ERROR(  cudaMemcpy( d_SrcEC_TEF_lambda, h_SrcEC_TEF_lambda, EC_TEF_MemSize, cudaMemcpyHostToDevice )  );
    CUDA_CHECK_ERROR(  cudaMemcpy( d_SrcEC_TEF_alpha,  h_SrcEC_TEF_alpha,  EC_TEF_MemSize, cudaMemcpyHostToDevice )  );
    CUDA_CHECK_ERROR(  cudaMemcpy( d_SrcEC_TEFc,       h_SrcEC_TEFc,       EC_TEF_MemSize, cudaMemcpyHostToDevice )  );
+   CUDA_CHECK_ERROR(  cudaMemcpy( d_SrcEC_TEF_Coeff,  h_SrcEC_TEF_Coeff,  EC_TEF_MemSize*SRC_EC_TEF_NCOEFF,
+                                  cudaMemcpyHostToDevice )  );
 
 } // FUNCTION : Src_PassData2GPU_ExactCooling
 #endif // #ifdef __CUDACC__
@@ -512,7 +1543,7 @@ void Src_SetCPUFunc_ExactCooling( SrcFunc_t &SrcFunc_CPUPtr )
 //
 // Note        :  1. Adopt the suggested approach for CUDA version >= 5.0
 //                2. Invoked by Src_Init_ExactCooling() and, if necessary, Src_WorkBeforeMajorFunc_ExactCooling()
-//                3. SRC_NAUX_USER is defined in Macro.h
+//                3. SRC_NAUX_EC is defined in Macro.h
 //
 // Parameter   :  AuxArray_Flt/Int : Auxiliary arrays to be copied to the constant memory
 //                DevPtr_Flt/Int   : Pointers to store the addresses of constant memory arrays
@@ -524,8 +1555,8 @@ void Src_SetConstMemory_ExactCooling( const double AuxArray_Flt[], const int Aux
 {
 
 // copy data to constant memory
-   CUDA_CHECK_ERROR(  cudaMemcpyToSymbol( c_Src_EC_AuxArray_Flt, AuxArray_Flt, SRC_NAUX_USER*sizeof(double) )  );
-   CUDA_CHECK_ERROR(  cudaMemcpyToSymbol( c_Src_EC_AuxArray_Int, AuxArray_Int, SRC_NAUX_USER*sizeof(int   ) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyToSymbol( c_Src_EC_AuxArray_Flt, AuxArray_Flt, SRC_NAUX_EC*sizeof(double) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyToSymbol( c_Src_EC_AuxArray_Int, AuxArray_Int, SRC_NAUX_EC*sizeof(int   ) )  );
 
 // obtain the constant-memory pointers
    CUDA_CHECK_ERROR(  cudaGetSymbolAddress( (void **)&DevPtr_Flt, c_Src_EC_AuxArray_Flt) );
@@ -565,15 +1596,6 @@ void Src_Init_ExactCooling()
 // set the auxiliary arrays
    Src_SetAuxArray_ExactCooling( Src_EC_AuxArray_Flt, Src_EC_AuxArray_Int );
 
-// copy the auxiliary arrays to the GPU constant memory and store the associated addresses
-#  ifdef GPU
-   Src_SetConstMemory_ExactCooling( Src_EC_AuxArray_Flt, Src_EC_AuxArray_Int,
-                                    SrcTerms.EC_AuxArrayDevPtr_Flt, SrcTerms.EC_AuxArrayDevPtr_Int );
-#  else
-   SrcTerms.EC_AuxArrayDevPtr_Flt = Src_EC_AuxArray_Flt;
-   SrcTerms.EC_AuxArrayDevPtr_Int = Src_EC_AuxArray_Int;
-#  endif
-
 // set the major source-term function
    Src_SetCPUFunc_ExactCooling( SrcTerms.EC_CPUPtr );
 
@@ -584,69 +1606,156 @@ void Src_Init_ExactCooling()
    SrcTerms.EC_FuncPtr = SrcTerms.EC_CPUPtr;
 #  endif
 
-   if ( OPT__INIT == 2 ){
-      for (int i=0; i<NLEVEL; i++)   IsInit_tcool[i] = true; 
+// check the metallicity-dependent cooling
+   if ( SrcTerms.EC_NZ > 1 )
+   {
+      if ( Idx_Metal == Idx_Undefined )
+         Aux_Error( ERROR_INFO, "Idx_Metal is undefined for SRC_EC_NZ (%d) > 1 !!\n", SrcTerms.EC_NZ );
+
+      if ( SrcTerms.EC_ZMax <= SrcTerms.EC_ZMin )
+         Aux_Error( ERROR_INFO, "SRC_EC_ZMAX (%14.7e) <= SRC_EC_ZMIN (%14.7e) for SRC_EC_NZ > 1 !!\n",
+                    SrcTerms.EC_ZMax, SrcTerms.EC_ZMin );
    }
 
 // Allocate h_SrcEC_* arrays
-   h_SrcEC_TEF_lambda = new double [SrcTerms.EC_TEF_N];
-   h_SrcEC_TEF_alpha  = new double [SrcTerms.EC_TEF_N];
-   h_SrcEC_TEFc       = new double [SrcTerms.EC_TEF_N];
-                                       
-   SrcTerms.EC_TEF_lambda_DevPtr = h_SrcEC_TEF_lambda;         
+// --> the SRC_EC_NZ TEF tables are stored one after another (i.e., h_SrcEC_TEF_lambda[ z*SRC_EC_TEF_N + k ])
+   const int TEF_NTot = SrcTerms.EC_TEF_N*SrcTerms.EC_NZ;
+
+   h_SrcEC_TEF_lambda = new double [TEF_NTot];
+   h_SrcEC_TEF_alpha  = new double [TEF_NTot];
+   h_SrcEC_TEFc       = new double [TEF_NTot];
+   h_SrcEC_TEF_Coeff  = new double [TEF_NTot*SRC_EC_TEF_NCOEFF];
+
+   SrcTerms.EC_TEF_lambda_DevPtr = h_SrcEC_TEF_lambda;
    SrcTerms.EC_TEF_alpha_DevPtr  = h_SrcEC_TEF_alpha;
    SrcTerms.EC_TEFc_DevPtr       = h_SrcEC_TEFc;
+   SrcTerms.EC_TEF_Coeff_DevPtr  = h_SrcEC_TEF_Coeff;
 
 
 // Initialize the cooling function (h_SrcEC_TEF_lambda / h_SrcEC_TEF_alpha / h_SrcEC_TEFc arrays)
    const int    TEF_N        = Src_EC_AuxArray_Int[0];   // number of points for lambda(T) sampling in LOG
-   const int    TEF_int      = TEF_N-1;                  // number of intervals
+   const int    TEF_NZ       = Src_EC_AuxArray_Int[2];   // number of TEF tables sampled in metallicity
    const double TEF_TN       = Src_EC_AuxArray_Flt[1];   // == Tref, high enough, but affects sampling resolution
    const double TEF_Tmin     = Src_EC_AuxArray_Flt[2];   // MIN temperature 
    const double TEF_dltemp   = Src_EC_AuxArray_Flt[3];   // sampling resolution (Kelvin), LOG!
+   const double cl_X         = SrcTerms.EC_X;            // mass-fraction of hydrogen
    const double cl_Z         = Src_EC_AuxArray_Flt[4];   // metallicity (in Zsun)
    const double cl_moli_mole = Src_EC_AuxArray_Flt[5];   // Assume the molecular weights are constant, mu_e*mu_i = 1.464 
-   const double cl_mol       = Src_EC_AuxArray_Flt[6];   // mean (total) molecular weights
    const double cl_mp        = Src_EC_AuxArray_Flt[7];   // proton mass
-   const double cl_kB_mp     = Src_EC_AuxArray_Flt[8];   // Boltzmann constant in erg/K
+   const double TEF_ZMin     = Src_EC_AuxArray_Flt[10];  // metallicity of the first TEF table
+   const double TEF_dZ       = 1.0/Src_EC_AuxArray_Flt[11];   // metallicity spacing of the TEF tables
+
+// Load the TEF tables from the binary cache if it matches the current setup
+   const bool   UseTable   = ( SRC_EC_TABLE    [0] != '\0'  &&  strcmp( SRC_EC_TABLE,     "NONE" ) != 0 );
+   const bool   UseCache   = ( SRC_EC_TEF_CACHE[0] != '\0'  &&  strcmp( SRC_EC_TEF_CACHE, "NONE" ) != 0 );
+   const char  *TableName  = ( UseTable ) ? SRC_EC_TABLE : NULL;
+   const double LambdaUnit = UNIT_E*pow(UNIT_L, 3)/UNIT_T;   // unit of the cooling function
+
+   bool LoadCache = false;
+   if ( UseCache )
+      LoadCache = Src_LoadTEFCache_ExactCooling( SRC_EC_TEF_CACHE, TableName, LambdaUnit, h_SrcEC_TEF_lambda,
+                                                 h_SrcEC_TEF_alpha, h_SrcEC_TEFc, h_SrcEC_TEF_Coeff );
+
+   if ( LoadCache ) {
+      if ( MPI_Rank == 0 )   Aux_Message( stdout, "   Load the TEF tables from \"%s\"\n", SRC_EC_TEF_CACHE );
+   }
 
-   double emis, LAMBDAT, Ti, Tip1;
-// k = TEF_N-1
-   Cool_fct(1.0, TEF_TN, &emis, &LAMBDAT, cl_Z, cl_moli_mole, cl_mp);
-   h_SrcEC_TEF_lambda[TEF_N-1] = LAMBDAT*cl_mol/cl_moli_mole/cl_kB_mp;
-   h_SrcEC_TEF_alpha[TEF_N-1]  = 0.0;  //h_SrcEC_TEF_alpha[TEF_N-2];   // is never required >> just as N-2
-   printf("Debugging!! TEF_TN = %14.8e, cl_Z = %14.8e, cl_moli_mole = %14.8e, cl_mp = %14.8e, LAMBDAT = %14.8e, cl_kB_mp = %14.8e, LAMBDAT*cl_mol/cl_moli_mole/cl_kB_mp = %14.8e\n", TEF_TN, cl_Z, cl_moli_mole, cl_mp, LAMBDAT, cl_kB_mp, LAMBDAT*cl_mol/cl_moli_mole/cl_kB_mp);
-    
-   for (int i=TEF_N-2; i>=0; i--){
-      Ti   = POW(10, log10(TEF_Tmin) + i*TEF_dltemp);
-      Tip1 = POW(10, log10(TEF_Tmin) + (i+1)*TEF_dltemp);
-      Cool_fct(1.0, Ti, &emis, &LAMBDAT, cl_Z, cl_moli_mole, cl_mp);
-      h_SrcEC_TEF_lambda[i] = LAMBDAT*cl_mol/cl_moli_mole/cl_kB_mp;
-#     ifdef GAMER_DEBUG
-      if ( h_SrcEC_TEF_lambda[i] <= 0.0 ){
-         Aux_Error( ERROR_INFO, "h_SrcEC_TEF_lambda[i] invalid (can not be smaller or equal to zero)!!\n" );
+   else {
+//    Set the metallicity of each TEF table
+//    --> use SRC_EC_Z when there is only one table
+      double *TEF_Z = new double [TEF_NZ];
+      if ( TEF_NZ == 1 )   TEF_Z[0] = cl_Z;
+      else
+         for (int z=0; z<TEF_NZ; z++)   TEF_Z[z] = TEF_ZMin + z*TEF_dZ;
+
+//    Get the cooling function LAMBDAT (in code units) of all tables at the sampling temperatures
+//    --> the last point is sampled at TEF_TN exactly
+//    --> either from the table SRC_EC_TABLE or from the analytic fit Cool_fct()
+      double emis, LAMBDAT;
+      double *TEF_Temp = new double [TEF_N];
+      for (int i=0; i<TEF_N-1; i++)   TEF_Temp[i] = POW(10.0, log10(TEF_Tmin) + i*TEF_dltemp);
+      TEF_Temp[TEF_N-1] = TEF_TN;
+
+      if ( UseTable ) {
+         Src_LoadCoolingTable_ExactCooling( SRC_EC_TABLE, TEF_NZ, TEF_Z, TEF_N, TEF_Temp, h_SrcEC_TEF_lambda );
+         for (int i=0; i<TEF_NTot; i++)   h_SrcEC_TEF_lambda[i] /= LambdaUnit;
+      }
+      else {
+         for (int z=0; z<TEF_NZ; z++)
+         for (int i=0; i<TEF_N; i++){
+            Cool_fct(1.0, TEF_Temp[i], &emis, &LAMBDAT, TEF_Z[z], cl_moli_mole, cl_mp);
+            h_SrcEC_TEF_lambda[ z*TEF_N + i ] = LAMBDAT;
+         }
+      }
+
+      delete [] TEF_Temp;
+
+//    Build the TEF tables one by one
+//    --> the mean molecular weight also depends on the metallicity of each table
+      for (int z=0; z<TEF_NZ; z++){
+         const double cl_mol = 1.0/(2*cl_X+0.75*(1-cl_X-TEF_Z[z])+TEF_Z[z]*0.5);
+         Src_BuildTEF_ExactCooling( cl_mol, h_SrcEC_TEF_lambda+z*TEF_N, h_SrcEC_TEF_alpha+z*TEF_N, h_SrcEC_TEFc+z*TEF_N,
+                                    h_SrcEC_TEF_Coeff+z*TEF_N*SRC_EC_TEF_NCOEFF );
+      }
+
+      delete [] TEF_Z;
+
+//    Store the TEF tables for restarts
+      if ( UseCache  &&  MPI_Rank == 0 )
+         Src_SaveTEFCache_ExactCooling( SRC_EC_TEF_CACHE, TableName, LambdaUnit, h_SrcEC_TEF_lambda, h_SrcEC_TEF_alpha,
+                                        h_SrcEC_TEFc, h_SrcEC_TEF_Coeff );
+   } // if ( LoadCache ) ... else ...
+
+// Enable the bisection search of the new interval only if TEFc[] of all tables is strictly decreasing
+// --> otherwise it may not reproduce the linear scan bit by bit
+   bool TEFc_Decreasing = true;
+   for (int z=0; z<TEF_NZ  &&  TEFc_Decreasing; z++){
+      const double *TEFc = h_SrcEC_TEFc + z*TEF_N;
+      for (int i=0; i<TEF_N-1; i++){
+         if (  !( TEFc[i] > TEFc[i+1] )  ){
+            TEFc_Decreasing = false;
+            break;
+         }
       }
-#     endif
-      h_SrcEC_TEF_alpha[i]  = (log10(h_SrcEC_TEF_lambda[i+1]) - log10(h_SrcEC_TEF_lambda[i])) / (log10(Tip1) - log10(Ti));
    }
-    
-// Initialize the constant of intregration
-   double Ti_2, Tip1_2;
-   h_SrcEC_TEFc[TEF_N-1] = 0.0;   // TEF(Tref)
-   for (int i=TEF_N-2; i>=0; i--){
-      Ti_2   = POW(10.0, log10(TEF_Tmin) + i*TEF_dltemp);
-      Tip1_2 = POW(10.0, log10(TEF_Tmin) + (i+1)*TEF_dltemp);
-      if (h_SrcEC_TEF_alpha[i] != 1.0){
-         h_SrcEC_TEFc[i] = h_SrcEC_TEFc[i+1] - (1.0/(1.0-h_SrcEC_TEF_alpha[i]))*(h_SrcEC_TEF_lambda[TEF_N-1]/h_SrcEC_TEF_lambda[i])*(Ti_2/TEF_TN)*(1.0-POW(Ti_2/Tip1_2, h_SrcEC_TEF_alpha[i]-1.0));
-      } 
-      else   h_SrcEC_TEFc[i] = h_SrcEC_TEFc[i+1] - (h_SrcEC_TEF_lambda[TEF_N-1]/h_SrcEC_TEF_lambda[i])*(Ti_2/TEF_TN)*log(Ti_2/Tip1_2);
+   Src_EC_AuxArray_Int[1] = TEFc_Decreasing;
+
+   if ( !TEFc_Decreasing  &&  MPI_Rank == 0 )
+      Aux_Message( stderr, "WARNING : TEFc[] is not strictly decreasing --> disable the bisection search in %s !!\n",
+                   __FUNCTION__ );
+
+// Group the per-interval data of all tables in a single-precision array for the mixed-precision mode
+// --> only used by CPU_SrcSolver_ExactCooling()
+#  ifndef GPU
+   if ( SrcTerms.EC_MixedPrecision ) {
+      h_SrcEC_TEF_Mixed = new real [TEF_NTot*SRC_EC_MIX_NVAR];
+
+      for (int t=0; t<TEF_NTot; t++){
+         real         *Mix   = h_SrcEC_TEF_Mixed + t*SRC_EC_MIX_NVAR;
+         const double *Coeff = h_SrcEC_TEF_Coeff + t*SRC_EC_TEF_NCOEFF;
+
+         Mix[SRC_EC_MIX_TK    ] = (real)Coeff[SRC_EC_TEF_TK ];
+         Mix[SRC_EC_MIX_LAMBDA] = (real)h_SrcEC_TEF_lambda[t];
+         Mix[SRC_EC_MIX_ALPHA ] = (real)h_SrcEC_TEF_alpha [t];
+         Mix[SRC_EC_MIX_FWD   ] = (real)Coeff[SRC_EC_TEF_FWD];
+         Mix[SRC_EC_MIX_INV   ] = (real)Coeff[SRC_EC_TEF_INV];
+         Mix[SRC_EC_MIX_EXP   ] = (real)Coeff[SRC_EC_TEF_EXP];
+      }
    }
+#  endif
 
+// copy the auxiliary arrays to the GPU constant memory and store the associated addresses
 #  ifdef GPU
-   Src_PassData2GPU_ExactCooling();
+   Src_SetConstMemory_ExactCooling( Src_EC_AuxArray_Flt, Src_EC_AuxArray_Int,
+                                    SrcTerms.EC_AuxArrayDevPtr_Flt, SrcTerms.EC_AuxArrayDevPtr_Int );
+#  else
+   SrcTerms.EC_AuxArrayDevPtr_Flt = Src_EC_AuxArray_Flt;
+   SrcTerms.EC_AuxArrayDevPtr_Int = Src_EC_AuxArray_Int;
 #  endif
 
-   printf( "Debugging!! Finish lambda initialization. h_SrcEC_TEF_lambda[TEF_N-1] = %14.8e.\n", h_SrcEC_TEF_lambda[TEF_N-1] );
+#  ifdef GPU
+   Src_PassData2GPU_ExactCooling();
+#  endif
 
 // set the auxiliary functions
 //   Src_WorkBeforeMajorFunc_EC_Ptr = Src_WorkBeforeMajorFunc_ExactCooling;
@@ -656,6 +1765,89 @@ void Src_Init_ExactCooling()
 
 
 
+//-----------------------------------------------------------------------------------------
+// Function    :  Src_BuildTEF_ExactCooling
+// Description :  Build a single TEF table from the cooling function
+//
+// Note        :  1. Invoked by Src_Init_ExactCooling() for each of the SRC_EC_NZ TEF tables
+//
+// Parameter   :  cl_mol     : Mean (total) molecular weight of this table
+//                TEF_lambda : Cooling function LAMBDAT (in code units) at the sampling temperatures
+//                             --> Will be overwritten by the normalized cooling rate
+//                TEF_alpha  : Array to store the power-law index of each interval
+//                TEFc       : Array to store the TEF value at the lower bound of each interval
+//                TEF_Coeff  : Array to store the per-interval coefficients
+//
+// Return      :  TEF_lambda[], TEF_alpha[], TEFc[], TEF_Coeff[]
+//-----------------------------------------------------------------------------------------
+void Src_BuildTEF_ExactCooling( const double cl_mol, double TEF_lambda[], double TEF_alpha[], double TEFc[],
+                                double TEF_Coeff[] )
+{
+
+   const int    TEF_N        = Src_EC_AuxArray_Int[0];   // number of points for lambda(T) sampling in LOG
+   const double TEF_TN       = Src_EC_AuxArray_Flt[1];   // == Tref, high enough, but affects sampling resolution
+   const double TEF_Tmin     = Src_EC_AuxArray_Flt[2];   // MIN temperature 
+   const double TEF_dltemp   = Src_EC_AuxArray_Flt[3];   // sampling resolution (Kelvin), LOG!
+   const double cl_moli_mole = Src_EC_AuxArray_Flt[5];   // Assume the molecular weights are constant, mu_e*mu_i = 1.464 
+   const double cl_kB_mp     = Src_EC_AuxArray_Flt[8];   // Boltzmann constant in erg/K
+
+   double Ti, Tip1;
+
+// Set the lower temperature bound of each interval
+// --> all per-interval coefficients are stored in TEF_Coeff[ k*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_* ] so that
+//     Src_ExactCooling() does not need to recompute them for every cell
+   for (int k=0; k<TEF_N; k++)   TEF_Coeff[ k*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_TK ] = POW(10.0, log10(TEF_Tmin) + k*TEF_dltemp);
+
+// k = TEF_N-1
+   TEF_lambda[TEF_N-1] = TEF_lambda[TEF_N-1]*cl_mol/cl_moli_mole/cl_kB_mp;
+   TEF_alpha[TEF_N-1]  = 0.0;  //TEF_alpha[TEF_N-2];   // is never required >> just as N-2
+
+   for (int i=TEF_N-2; i>=0; i--){
+      Ti   = TEF_Coeff[ (i  )*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_TK ];
+      Tip1 = TEF_Coeff[ (i+1)*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_TK ];
+      TEF_lambda[i] = TEF_lambda[i]*cl_mol/cl_moli_mole/cl_kB_mp;
+      if ( TEF_lambda[i] <= 0.0 ){
+         Aux_Error( ERROR_INFO, "h_SrcEC_TEF_lambda[%d] = %14.7e invalid (can not be smaller or equal to zero)!!\n",
+                    i, TEF_lambda[i] );
+      }
+      TEF_alpha[i]  = (log10(TEF_lambda[i+1]) - log10(TEF_lambda[i])) / (log10(Tip1) - log10(Ti));
+   }
+
+// Precompute the per-interval coefficients of TEF() and TEFinv()
+//    alpha_k != 1 : FWD = 1/(1-alpha_k)*(lambda_N/lambda_k)*(Tk/TN), INV = (1-alpha_k)*(lambda_k/lambda_N)*(TN/Tk), EXP = 1/(1-alpha_k)
+//    alpha_k == 1 : FWD =               (lambda_N/lambda_k)*(Tk/TN), INV =             (lambda_k/lambda_N)*(TN/Tk), EXP = 0 (unused)
+   for (int k=0; k<TEF_N; k++){
+      double      *Coeff = TEF_Coeff + k*SRC_EC_TEF_NCOEFF;
+      const double Tk    = Coeff[SRC_EC_TEF_TK];
+      const double alpha = TEF_alpha[k];
+
+      if (alpha != 1.0){
+         Coeff[SRC_EC_TEF_FWD] = (1.0/(1.0-alpha))*(TEF_lambda[TEF_N-1]/TEF_lambda[k])*(Tk/TEF_TN);
+         Coeff[SRC_EC_TEF_INV] = (1.0-alpha)*(TEF_lambda[k]/TEF_lambda[TEF_N-1])*(TEF_TN/Tk);
+         Coeff[SRC_EC_TEF_EXP] = 1.0/(1.0-alpha);
+      }
+      else {
+         Coeff[SRC_EC_TEF_FWD] = (TEF_lambda[TEF_N-1]/TEF_lambda[k])*(Tk/TEF_TN);
+         Coeff[SRC_EC_TEF_INV] = (TEF_lambda[k]/TEF_lambda[TEF_N-1])*(TEF_TN/Tk);
+         Coeff[SRC_EC_TEF_EXP] = 0.0;
+      }
+   }
+
+// Initialize the constant of intregration
+   TEFc[TEF_N-1] = 0.0;   // TEF(Tref)
+   for (int i=TEF_N-2; i>=0; i--){
+      Ti   = TEF_Coeff[ (i  )*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_TK ];
+      Tip1 = TEF_Coeff[ (i+1)*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_TK ];
+      if (TEF_alpha[i] != 1.0){
+         TEFc[i] = TEFc[i+1] - TEF_Coeff[ i*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_FWD ]*(1.0-POW(Ti/Tip1, TEF_alpha[i]-1.0));
+      }
+      else   TEFc[i] = TEFc[i+1] - TEF_Coeff[ i*SRC_EC_TEF_NCOEFF + SRC_EC_TEF_FWD ]*log(Ti/Tip1);
+   }
+
+} // FUNCTION : Src_BuildTEF_ExactCooling
+
+
+
 // Sutherland-Dopita cooling function, with optimal parmetrization over a wide range of T and Z
 void Cool_fct( double Dens, double Temp, double* Emis, double* Lambdat, double Z, double cl_moli_mole, double mp ){ 
  
@@ -731,10 +1923,13 @@ void Src_End_ExactCooling()
    delete [] h_SrcEC_TEF_lambda;     h_SrcEC_TEF_lambda = NULL;        
    delete [] h_SrcEC_TEF_alpha;      h_SrcEC_TEF_alpha  = NULL;
    delete [] h_SrcEC_TEFc;           h_SrcEC_TEFc       = NULL;
+   delete [] h_SrcEC_TEF_Coeff;      h_SrcEC_TEF_Coeff  = NULL;
+   delete [] h_SrcEC_TEF_Mixed;      h_SrcEC_TEF_Mixed  = NULL;
                  
    SrcTerms.EC_TEF_lambda_DevPtr = NULL;
    SrcTerms.EC_TEF_alpha_DevPtr  = NULL;
    SrcTerms.EC_TEFc_DevPtr       = NULL;
+   SrcTerms.EC_TEF_Coeff_DevPtr  = NULL;
 
 #  ifdef GPU
    CUAPI_MemFree_ExactCooling();
@@ -762,10 +1957,12 @@ void CUAPI_MemFree_ExactCooling()
    if ( d_SrcEC_TEF_lambda != NULL ) {  CUDA_CHECK_ERROR(  cudaFree( d_SrcEC_TEF_lambda )  );  d_SrcEC_TEF_lambda = NULL; } 
    if ( d_SrcEC_TEF_alpha  != NULL ) {  CUDA_CHECK_ERROR(  cudaFree( d_SrcEC_TEF_alpha  )  );  d_SrcEC_TEF_alpha  = NULL; }
    if ( d_SrcEC_TEFc       != NULL ) {  CUDA_CHECK_ERROR(  cudaFree( d_SrcEC_TEFc       )  );  d_SrcEC_TEFc       = NULL; }
+   if ( d_SrcEC_TEF_Coeff  != NULL ) {  CUDA_CHECK_ERROR(  cudaFree( d_SrcEC_TEF_Coeff  )  );  d_SrcEC_TEF_Coeff  = NULL; }
          
    SrcTerms.EC_TEF_lambda_DevPtr = NULL;
    SrcTerms.EC_TEF_alpha_DevPtr  = NULL;
    SrcTerms.EC_TEFc_DevPtr       = NULL;
+   SrcTerms.EC_TEF_Coeff_DevPtr  = NULL;
 
 } // FUNCTION : CUAPI_MemFree_ExactCooling
 #endif // #ifdef __CUDACC__
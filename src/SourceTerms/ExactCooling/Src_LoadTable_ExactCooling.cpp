@@ -0,0 +1,378 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO )
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+// version of the binary TEF cache
+// --> must be increased whenever the construction of the TEF tables in Src_Init_ExactCooling() is changed
+#define EC_TEF_CACHE_VERSION     2
+
+// header of the binary TEF cache
+// --> the cache is reused only if the entire header matches the current setup
+struct EC_TEFCacheHeader_t
+{
+   char          Magic[16];
+   int           Version;
+   int           TEF_N;
+   int           NZ;
+   int           NCoeff;
+   int           NAux;
+   double        AuxArray_Flt[SRC_NAUX_EC];
+   double        LambdaUnit;
+   unsigned long TableHash;
+}; // struct EC_TEFCacheHeader_t
+
+static const char EC_TEF_CACHE_MAGIC[16] = "GAMER_EC_TEF";
+
+static void          SetCacheHeader( EC_TEFCacheHeader_t &Header, const char *TableName, const double LambdaUnit );
+static unsigned long HashFile( const char *FileName );
+static double        InterpLogLog( const double x, const int N, const double Table_x[], const double Table_y[] );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_LoadCoolingTable_ExactCooling
+// Description :  Load the tabulated cooling function Lambda(T,Z) and interpolate it to the target
+//                temperatures and metallicities
+//
+// Note        :  1. Invoked by Src_Init_ExactCooling()
+//                2. The table must have three columns: [metallicity] [temperature in K] [Lambda in erg*cm^3/s]
+//                   --> Rows of the same metallicity must be grouped together and sorted into ascending
+//                       temperature order
+//                   --> Groups must be sorted into ascending metallicity order
+//                   --> Lambda is normalized such that the emissivity = n_e*n_i*Lambda, which is the same
+//                       as Cool_fct()
+//                   --> Load by Aux_LoadTable() and thus comments (#) and empty lines are allowed
+//                3. Interpolation is linear in log(T)-log(Lambda) and linear in Z
+//                   --> Lambda is extrapolated as a power law beyond the tabulated temperature range
+//                   --> Z is clamped to the tabulated metallicity range
+//
+// Parameter   :  FileName : Filename of the table
+//                NZ       : Number of target metallicities
+//                Z        : Target metallicities
+//                NT       : Number of target temperatures
+//                Temp     : Target temperatures in K
+//                Lambda   : Array to store the interpolated cooling function in erg*cm^3/s
+//                           --> Lambda[ z*NT + t ] for the metallicity Z[z] and temperature Temp[t]
+//
+// Return      :  Lambda[]
+//-------------------------------------------------------------------------------------------------------
+void Src_LoadCoolingTable_ExactCooling( const char *FileName, const int NZ, const double Z[], const int NT,
+                                        const double Temp[], double Lambda[] )
+{
+
+   if ( !Aux_CheckFileExist(FileName) )
+      Aux_Error( ERROR_INFO, "ExactCooling table \"%s\" does not exist !!\n", FileName );
+
+
+// 1. load the table
+   const bool RowMajor_No  = false;
+   const bool AllocMem_Yes = true;
+   const int  NCol         = 3;
+   const int  Col[NCol]    = {0, 1, 2};
+
+   double *Table = NULL;
+   const int NRow = Aux_LoadTable( Table, FileName, NCol, Col, RowMajor_No, AllocMem_Yes );
+
+   const double *Table_Z = Table + 0*NRow;
+   const double *Table_T = Table + 1*NRow;
+   const double *Table_L = Table + 2*NRow;
+
+
+// 2. find the groups of rows with the same metallicity and check the table
+   int  NGroup = 0;
+   int *Start  = new int [NRow+1];
+
+   for (int r=0; r<NRow; r++)
+   {
+      if ( Table_T[r] <= 0.0  ||  Table_L[r] <= 0.0 )
+         Aux_Error( ERROR_INFO, "non-positive T (%14.7e) or Lambda (%14.7e) at row %d in \"%s\" !!\n",
+                    Table_T[r], Table_L[r], r, FileName );
+
+      if ( r == 0  ||  Table_Z[r] != Table_Z[r-1] )
+      {
+         if ( r > 0  &&  Table_Z[r] < Table_Z[r-1] )
+            Aux_Error( ERROR_INFO, "metallicity is not in ascending order at row %d in \"%s\" !!\n", r, FileName );
+
+         Start[ NGroup ++ ] = r;
+      }
+
+      else if ( Table_T[r] <= Table_T[r-1] )
+         Aux_Error( ERROR_INFO, "temperature is not in ascending order at row %d in \"%s\" !!\n", r, FileName );
+   }
+
+   Start[NGroup] = NRow;
+
+   for (int g=0; g<NGroup; g++)
+   {
+      if ( Start[g+1] - Start[g] < 2 )
+         Aux_Error( ERROR_INFO, "metallicity %14.7e has less than 2 rows in \"%s\" !!\n",
+                    Table_Z[ Start[g] ], FileName );
+   }
+
+
+// 3. interpolate in Z between the two bracketing groups and then in T
+   for (int z=0; z<NZ; z++)
+   {
+      int    g0 = 0, g1 = 0;
+      double wZ = 0.0;
+
+      if      ( Z[z] <= Table_Z[ Start[0       ] ] )   g0 = g1 = 0;
+      else if ( Z[z] >= Table_Z[ Start[NGroup-1] ] )   g0 = g1 = NGroup-1;
+      else
+      {
+         while ( Table_Z[ Start[g0+1] ] <= Z[z] )   g0 ++;
+         g1 = g0 + 1;
+         wZ = ( Z[z] - Table_Z[ Start[g0] ] ) / ( Table_Z[ Start[g1] ] - Table_Z[ Start[g0] ] );
+      }
+
+      if (  MPI_Rank == 0  &&  ( Z[z] < Table_Z[ Start[0] ]  ||  Z[z] > Table_Z[ Start[NGroup-1] ] )  )
+         Aux_Message( stderr, "WARNING : Z (%14.7e) lies outside the tabulated range [%14.7e, %14.7e] in \"%s\" !!\n",
+                      Z[z], Table_Z[ Start[0] ], Table_Z[ Start[NGroup-1] ], FileName );
+
+      for (int t=0; t<NT; t++)
+      {
+         const double L0 = InterpLogLog( Temp[t], Start[g0+1]-Start[g0], Table_T+Start[g0], Table_L+Start[g0] );
+         const double L1 = InterpLogLog( Temp[t], Start[g1+1]-Start[g1], Table_T+Start[g1], Table_L+Start[g1] );
+
+         Lambda[ z*NT + t ] = ( 1.0 - wZ )*L0 + wZ*L1;
+      }
+   }
+
+
+   delete [] Table;
+   delete [] Start;
+
+} // FUNCTION : Src_LoadCoolingTable_ExactCooling
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  InterpLogLog
+// Description :  Linear interpolation in log(x)-log(y)
+//
+// Note        :  1. Table_x[] must be strictly increasing and N >= 2
+//                2. Power-law extrapolation using the first/last interval beyond the table range
+//
+// Parameter   :  x       : Target x
+//                N       : Number of rows in the table
+//                Table_x : x in the table
+//                Table_y : y in the table
+//
+// Return      :  y(x)
+//-------------------------------------------------------------------------------------------------------
+double InterpLogLog( const double x, const int N, const double Table_x[], const double Table_y[] )
+{
+
+// find the interval [i, i+1] by bisection
+   int lo = 0, hi = N-1;
+
+   while ( hi - lo > 1 )
+   {
+      const int mid = ( lo + hi ) / 2;
+      if ( Table_x[mid] <= x )   lo = mid;
+      else                       hi = mid;
+   }
+
+   const double slope = log( Table_y[hi]/Table_y[lo] ) / log( Table_x[hi]/Table_x[lo] );
+
+   return Table_y[lo]*pow( x/Table_x[lo], slope );
+
+} // FUNCTION : InterpLogLog
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_LoadTEFCache_ExactCooling
+// Description :  Load the TEF tables from a binary cache file
+//
+// Note        :  1. Invoked by Src_Init_ExactCooling()
+//                2. The cache file is memory-mapped and its header is compared with the current setup
+//                   --> See SetCacheHeader() for the setup recorded in the header
+//                   --> Return false if the file does not exist or does not match
+//                3. Created by Src_SaveTEFCache_ExactCooling()
+//
+// Parameter   :  FileName   : Filename of the cache
+//                TableName  : Filename of the cooling-function table (NULL if the analytic fit is used)
+//                LambdaUnit : Unit of the cooling function
+//                TEF_*      : TEF tables to be filled up
+//
+// Return      :  true/false --> load the cache successfully/unsuccessfully
+//                TEF_lambda[], TEF_alpha[], TEFc[], TEF_Coeff[]
+//-------------------------------------------------------------------------------------------------------
+bool Src_LoadTEFCache_ExactCooling( const char *FileName, const char *TableName, const double LambdaUnit,
+                                    double TEF_lambda[], double TEF_alpha[], double TEFc[], double TEF_Coeff[] )
+{
+
+   const int  TEF_N    = SrcTerms.EC_TEF_N;
+   const long MemSize1 = sizeof(double)*TEF_N*SrcTerms.EC_NZ;
+   const long FileSize = sizeof(EC_TEFCacheHeader_t) + 3*MemSize1 + SRC_EC_TEF_NCOEFF*MemSize1;
+
+   const int fd = open( FileName, O_RDONLY );
+   if ( fd < 0 )   return false;
+
+   struct stat Stat;
+   if ( fstat( fd, &Stat ) != 0  ||  (long)Stat.st_size != FileSize )
+   {
+      close( fd );
+      return false;
+   }
+
+   char *Data = (char*)mmap( NULL, FileSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+   close( fd );
+
+   if ( Data == MAP_FAILED )   return false;
+
+
+// compare the header
+   EC_TEFCacheHeader_t Header;
+   SetCacheHeader( Header, TableName, LambdaUnit );
+
+   const bool Match = ( memcmp( Data, &Header, sizeof(EC_TEFCacheHeader_t) ) == 0 );
+
+   if ( Match )
+   {
+      const char *Ptr = Data + sizeof(EC_TEFCacheHeader_t);
+
+      memcpy( TEF_lambda, Ptr, MemSize1 );                     Ptr += MemSize1;
+      memcpy( TEF_alpha,  Ptr, MemSize1 );                     Ptr += MemSize1;
+      memcpy( TEFc,       Ptr, MemSize1 );                     Ptr += MemSize1;
+      memcpy( TEF_Coeff,  Ptr, SRC_EC_TEF_NCOEFF*MemSize1 );
+   }
+
+   else if ( MPI_Rank == 0 )
+      Aux_Message( stderr, "WARNING : TEF cache \"%s\" does not match the current setup --> rebuild it !!\n",
+                   FileName );
+
+   munmap( Data, FileSize );
+
+   return Match;
+
+} // FUNCTION : Src_LoadTEFCache_ExactCooling
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_SaveTEFCache_ExactCooling
+// Description :  Store the TEF tables in a binary cache file
+//
+// Note        :  1. Invoked by Src_Init_ExactCooling() on the root rank
+//                2. Write to a temporary file first and then rename it so that other ranks never see
+//                   an incomplete cache
+//                3. Format: [EC_TEFCacheHeader_t] [TEF_lambda] [TEF_alpha] [TEFc] [TEF_Coeff]
+//                   --> Each TEF_* array stores the SRC_EC_NZ tables one after another
+//
+// Parameter   :  FileName   : Filename of the cache
+//                TableName  : Filename of the cooling-function table (NULL if the analytic fit is used)
+//                LambdaUnit : Unit of the cooling function
+//                TEF_*      : TEF tables to be stored
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Src_SaveTEFCache_ExactCooling( const char *FileName, const char *TableName, const double LambdaUnit,
+                                    const double TEF_lambda[], const double TEF_alpha[], const double TEFc[],
+                                    const double TEF_Coeff[] )
+{
+
+   const int TEF_N = SrcTerms.EC_TEF_N*SrcTerms.EC_NZ;
+
+   EC_TEFCacheHeader_t Header;
+   SetCacheHeader( Header, TableName, LambdaUnit );
+
+   char FileName_Tmp[2*MAX_STRING];
+   sprintf( FileName_Tmp, "%s.tmp", FileName );
+
+   FILE *File = fopen( FileName_Tmp, "wb" );
+
+   if ( File == NULL )
+   {
+      Aux_Message( stderr, "WARNING : cannot create the TEF cache \"%s\" !!\n", FileName_Tmp );
+      return;
+   }
+
+   fwrite( &Header,    sizeof(EC_TEFCacheHeader_t), 1,                       File );
+   fwrite( TEF_lambda, sizeof(double),              TEF_N,                   File );
+   fwrite( TEF_alpha,  sizeof(double),              TEF_N,                   File );
+   fwrite( TEFc,       sizeof(double),              TEF_N,                   File );
+   fwrite( TEF_Coeff,  sizeof(double),              TEF_N*SRC_EC_TEF_NCOEFF, File );
+   fclose( File );
+
+   if ( rename( FileName_Tmp, FileName ) != 0 )
+      Aux_Message( stderr, "WARNING : cannot rename \"%s\" to \"%s\" !!\n", FileName_Tmp, FileName );
+
+} // FUNCTION : Src_SaveTEFCache_ExactCooling
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCacheHeader
+// Description :  Set the header of the binary TEF cache according to the current setup
+//
+// Note        :  1. Record EC_TEF_CACHE_VERSION, SRC_EC_TEF_N, SRC_EC_NZ, SRC_EC_TEF_NCOEFF, Src_EC_AuxArray_Flt[],
+//                   the unit of the cooling function, and a hash of the cooling-function table
+//                2. Zero the entire header first so that it can be compared by memcmp()
+//
+// Parameter   :  Header     : Header to be set
+//                TableName  : Filename of the cooling-function table (NULL if the analytic fit is used)
+//                LambdaUnit : Unit of the cooling function
+//
+// Return      :  Header
+//-------------------------------------------------------------------------------------------------------
+void SetCacheHeader( EC_TEFCacheHeader_t &Header, const char *TableName, const double LambdaUnit )
+{
+
+   memset( &Header, 0, sizeof(EC_TEFCacheHeader_t) );
+
+   memcpy( Header.Magic, EC_TEF_CACHE_MAGIC, sizeof(Header.Magic) );
+   Header.Version    = EC_TEF_CACHE_VERSION;
+   Header.TEF_N      = SrcTerms.EC_TEF_N;
+   Header.NZ         = SrcTerms.EC_NZ;
+   Header.NCoeff     = SRC_EC_TEF_NCOEFF;
+   Header.NAux       = SRC_NAUX_EC;
+   for (int t=0; t<SRC_NAUX_EC; t++)   Header.AuxArray_Flt[t] = Src_EC_AuxArray_Flt[t];
+   Header.LambdaUnit = LambdaUnit;
+   Header.TableHash  = ( TableName == NULL ) ? 0UL : HashFile( TableName );
+
+} // FUNCTION : SetCacheHeader
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  HashFile
+// Description :  Return the 64-bit FNV-1a hash of the content of a file
+//
+// Parameter   :  FileName : Target file
+//
+// Return      :  Hash value
+//-------------------------------------------------------------------------------------------------------
+unsigned long HashFile( const char *FileName )
+{
+
+   FILE *File = fopen( FileName, "rb" );
+
+   if ( File == NULL )   Aux_Error( ERROR_INFO, "file \"%s\" does not exist !!\n", FileName );
+
+   unsigned long Hash = 14695981039346656037UL;
+   int c;
+
+   while (  ( c = fgetc(File) ) != EOF  )
+   {
+      Hash ^= (unsigned long)c;
+      Hash *= 1099511628211UL;
+   }
+
+   fclose( File );
+
+   return Hash;
+
+} // FUNCTION : HashFile
+
+
+
+#endif // #if ( MODEL == HYDRO )
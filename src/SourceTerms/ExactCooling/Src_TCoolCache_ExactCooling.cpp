@@ -0,0 +1,132 @@
+#include "GAMER.h"
+
+
+
+// derived-field cache of the cooling time
+// --> the field TCOOL on lv is valid only for the fluid sandglass TCool_Sg[lv] at the physical time TCool_Time[lv]
+// --> TCool_Valid[lv] is reset by Src_InvalidateTCool_ExactCooling() when the patches on lv are changed
+//     (e.g., after refining lv-1) or when the fluid data on lv are corrected by the fix-up operations
+static bool   TCool_Valid[NLEVEL] = { false };
+static int    TCool_Sg   [NLEVEL];
+static double TCool_Time [NLEVEL];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_ValidateTCool_ExactCooling
+// Description :  Record that the field TCOOL on lv has been computed from the fluid data stored in the
+//                sandglass "Sg" at the physical time "Time"
+//
+// Note        :  1. Invoked by Src_AdvanceDt(), Src_UpdateTCool_ExactCooling(), and Init_GAMER() during restart
+//
+// Parameter   :  lv   : Target refinement level
+//                Sg   : Fluid sandglass storing TCOOL
+//                Time : Physical time of the fluid data in Sg
+//-------------------------------------------------------------------------------------------------------
+void Src_ValidateTCool_ExactCooling( const int lv, const int Sg, const double Time )
+{
+
+   TCool_Valid[lv] = true;
+   TCool_Sg   [lv] = Sg;
+   TCool_Time [lv] = Time;
+
+} // FUNCTION : Src_ValidateTCool_ExactCooling
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_InvalidateTCool_ExactCooling
+// Description :  Invalidate the field TCOOL on lv
+//
+// Note        :  1. Must be invoked whenever patches on lv are created or removed, or the fluid data on lv are
+//                   modified, without going through Src_AdvanceDt() since TCOOL is neither restricted nor
+//                   interpolated consistently
+//                   --> e.g., after refining lv-1 and after Flu_FixUp_Restrict()/Flu_FixUp_Flux() in EvolveLevel()
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Src_InvalidateTCool_ExactCooling( const int lv )
+{
+
+   TCool_Valid[lv] = false;
+
+} // FUNCTION : Src_InvalidateTCool_ExactCooling
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_IsValidTCool_ExactCooling
+// Description :  Check whether the field TCOOL on lv corresponds to the current fluid data
+//
+// Note        :  1. TCOOL is regarded as valid only if it was computed from the current fluid sandglass
+//                   amr->FluSg[lv] at its current physical time amr->FluSgTime[lv][ amr->FluSg[lv] ]
+//
+// Parameter   :  lv : Target refinement level
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool Src_IsValidTCool_ExactCooling( const int lv )
+{
+
+   const int FluSg = amr->FluSg[lv];
+
+   return (  TCool_Valid[lv]  &&  TCool_Sg[lv] == FluSg  &&  TCool_Time[lv] == amr->FluSgTime[lv][FluSg]  );
+
+} // FUNCTION : Src_IsValidTCool_ExactCooling
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_UpdateTCool_ExactCooling
+// Description :  Make sure the field TCOOL stored in all real patches on lv is up to date
+//
+// Note        :  1. Do nothing if TCOOL is still valid (see Src_IsValidTCool_ExactCooling())
+//                   --> Otherwise recompute it by invoking the exact-cooling solver with dt=0, which
+//                       leaves all other fields untouched
+//                2. Invoked by Mis_GetTimeStep_ExactCooling(), Flag_Real(), and Output_DumpData() so that
+//                   the time-step, refinement, and output share the same cooling time
+//                3. Must be invoked by all MPI ranks since the validity is a per-level state
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Src_UpdateTCool_ExactCooling( const int lv )
+{
+
+   if ( !SrcTerms.ExactCooling )             return;
+   if ( Src_IsValidTCool_ExactCooling(lv) )  return;
+
+
+   const int    FluSg = amr->FluSg[lv];
+   const double dh    = amr->dh[lv];
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      real (*Fluid)[PS1][PS1][PS1] = amr->patch[FluSg][lv][PID]->fluid;
+
+      for (int k=0; k<PS1; k++)  {  const double z = amr->patch[0][lv][PID]->EdgeL[2] + (k+0.5)*dh;
+      for (int j=0; j<PS1; j++)  {  const double y = amr->patch[0][lv][PID]->EdgeL[1] + (j+0.5)*dh;
+      for (int i=0; i<PS1; i++)  {  const double x = amr->patch[0][lv][PID]->EdgeL[0] + (i+0.5)*dh;
+
+#        ifdef MHD
+         real B[NCOMP_MAG];
+         MHD_GetCellCenteredBFieldInPatch( B, lv, PID, i, j, k, amr->MagSg[lv] );
+#        else
+         real *B = NULL;
+#        endif
+
+         real fluid[FLU_NIN_S];
+         for (int v=0; v<FLU_NIN_S; v++)  fluid[v] = Fluid[v][k][j][i];
+
+         SrcTerms.EC_CPUPtr( fluid, B, &SrcTerms, 0.0, NULL_REAL, x, y, z, NULL_REAL, NULL_REAL,
+                             MIN_DENS, MIN_PRES, MIN_EINT, NULL,
+                             Src_EC_AuxArray_Flt, Src_EC_AuxArray_Int );
+
+         Fluid[TCOOL][k][j][i] = fluid[TCOOL];
+      }}} // i,j,k
+   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+   Src_ValidateTCool_ExactCooling( lv, FluSg, amr->FluSgTime[lv][FluSg] );
+
+} // FUNCTION : Src_UpdateTCool_ExactCooling
@@ -1,7 +1,8 @@
 #include "GAMER.h"
 
 
-extern bool   IsInit_tcool[NLEVEL];
+extern bool   IsValid_tcool_min[NLEVEL];
+extern double tcool_min_for_solver[NLEVEL];
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -17,6 +18,10 @@ extern bool   IsInit_tcool[NLEVEL];
 //                2. Invoked by Mis_GetTimeStep() using the function pointer "Mis_GetTimeStep_User_Ptr",
 //                   which must be set by a test problem initializer
 //                3. Enabled by the runtime option "OPT__DT_USER"
+//                4. Use the minimum cooling time found in the latest source-term update on lv if available
+//                   --> Computed by Src_Close() and invalidated after refining lv-1
+//                   --> Otherwise sweep over all patches on lv using the cached field TCOOL, which is
+//                       recomputed by Src_UpdateTCool_ExactCooling() only if it is no longer valid
 //
 // Parameter   :  lv       : Target refinement level
 //                dTime_dt : dTime/dt (== 1.0 if COMOVING is off)
@@ -29,6 +34,25 @@ double Mis_GetTimeStep_ExactCooling( const int lv, const double dTime_dt )
    if ( !SrcTerms.ExactCooling )   return HUGE_NUMBER;
 
 
+   double dt_EC = HUGE_NUMBER;
+
+// use the minimum cooling time recorded in the source-term update
+   if ( IsValid_tcool_min[lv] )
+   {
+      dt_EC = tcool_min_for_solver[lv];
+
+#     ifndef SERIAL
+      MPI_Allreduce( MPI_IN_PLACE, &dt_EC, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD );
+#     endif
+
+      return dt_EC;
+   }
+
+
+// make sure the cached cooling time is up to date
+   Src_UpdateTCool_ExactCooling( lv );
+
+
 // allocate memory for per-thread arrays
 #  ifdef OPENMP
    const int NT = OMP_NTHREAD;   // number of OpenMP threads
@@ -36,7 +60,6 @@ double Mis_GetTimeStep_ExactCooling( const int lv, const double dTime_dt )
    const int NT = 1;
 #  endif
 
-   double  dt_EC     = HUGE_NUMBER;
    double *OMP_dt_EC = new double [NT];
 
 
@@ -51,49 +74,17 @@ double Mis_GetTimeStep_ExactCooling( const int lv, const double dTime_dt )
 //    initialize arrays
       OMP_dt_EC[TID] = __DBL_MAX__;
 
-      const double dh = amr->dh[lv];
-
 #     pragma omp for schedule( runtime )
       for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
       {
+         const real (*Fluid)[PS1][PS1][PS1] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid;
+
          for (int k=0; k<PS1; k++)  {
          for (int j=0; j<PS1; j++)  {
          for (int i=0; i<PS1; i++)  {
 
-#           ifdef MHD
-            real B[NCOMP_MAG];
-            MHD_GetCellCenteredBFieldInPatch( B, lv, PID, i, j, k, amr->MagSg[lv] );
-#           else
-            real *B    = NULL;
-#           endif // ifdef MHD ... else ...
-
-            real tcool_Code = NULL_REAL;
-
-            if ( IsInit_tcool[lv] ) {
-//             use the stored cooling time 
-#              ifdef TCOOL 
-               tcool_Code = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[TCOOL][k][j][i];
-#              endif
-            }
-            else {
-//             call Src_ExactCooling() to compute the cooling time if not initialized yet
-               const double z = amr->patch[0][lv][PID]->EdgeL[2] + (k+0.5)*dh;
-               const double y = amr->patch[0][lv][PID]->EdgeL[1] + (j+0.5)*dh;
-               const double x = amr->patch[0][lv][PID]->EdgeL[0] + (i+0.5)*dh;
-
-//             get the input arrays
-               real fluid[FLU_NIN_S];
-               for (int v=0; v<FLU_NIN_S; v++)  fluid[v] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
-               SrcTerms.EC_CPUPtr( fluid, B, &SrcTerms, 0.0, NULL_REAL, x, y, z, NULL_REAL, NULL_REAL,
-                                   MIN_DENS, MIN_PRES, MIN_EINT, NULL,
-                                   Src_EC_AuxArray_Flt, Src_EC_AuxArray_Int );
-#              ifdef TCOOL
-               tcool_Code = fluid[TCOOL];
-#              endif
-            } // if ( IsInit_tcool[lv] ) ... else ...
-
 //          compare the cooling time and store the minimum value
-            OMP_dt_EC[TID] = FMIN( OMP_dt_EC[TID], tcool_Code );
+            OMP_dt_EC[TID] = FMIN( OMP_dt_EC[TID], Fluid[TCOOL][k][j][i] );
 
          }}} // i,j,k
       } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
@@ -2,8 +2,10 @@
 
 
 
-// flag for checking whether the tcool field is initialized
-bool IsInit_tcool[NLEVEL] = { false };
+// minimum cooling time on each level found in the latest source-term update (set by Src_Close() or Flu_Close())
+// --> IsValid_tcool_min[] records whether tcool_min_for_solver[] has been computed
+double tcool_min_for_solver[NLEVEL];
+bool   IsValid_tcool_min   [NLEVEL] = { false };
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -14,6 +16,12 @@ bool IsInit_tcool[NLEVEL] = { false };
 //                2. Invoked by EvolveLevel()
 //                3. Grackle library is treated separately
 //                4. Invoke Src_WorkBeforeMajorFunc()
+//                5. Record the minimum cooling time on lv in tcool_min_for_solver[lv] for the exact cooling
+//                   --> Used by Mis_GetTimeStep_ExactCooling()
+//                6. Mark the field TCOOL on lv as valid for SaveSg_Flu at TimeNew for the exact cooling
+//                   --> See Src_TCoolCache_ExactCooling.cpp
+//                7. Not invoked by EvolveLevel() when SRC_FUSE_FLUID is on
+//                   --> Source terms are applied in Flu_Close() instead (see Src_Begin/EndFusedUpdate())
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -40,9 +48,67 @@ void Src_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
    Src_WorkBeforeMajorFunc( lv, TimeNew, TimeOld, dt );
 
 // major source-term function
+// --> tcool_min_for_solver[lv] will be set by Src_Close()
+   tcool_min_for_solver[lv] = HUGE_NUMBER;
+
    InvokeSolver( SRC_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT,
                  OverlapMPI, Overlap_Sync );
 
-   if ( SrcTerms.ExactCooling )   IsInit_tcool[lv] = true;
+   if ( SrcTerms.ExactCooling )
+   {
+      IsValid_tcool_min[lv] = true;
+      Src_ValidateTCool_ExactCooling( lv, SaveSg_Flu, TimeNew );
+   }
 
 } // FUNCTION : Src_AdvanceDt
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_BeginFusedUpdate
+// Description :  Work before applying the local source terms in Flu_Close() when SRC_FUSE_FLUID is on
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() before invoking the fluid solver
+//                   --> Invoked again for each AUTO_REDUCE_DT trial
+//                2. Replace the first half of Src_AdvanceDt()
+//
+// Parameter   :  lv      : Target refinement level
+//                TimeNew : Target physical time to reach
+//                TimeOld : Physical time before update
+//                dt      : Time interval to advance solution
+//-------------------------------------------------------------------------------------------------------
+void Src_BeginFusedUpdate( const int lv, const double TimeNew, const double TimeOld, const double dt )
+{
+
+   if ( ! SrcTerms.Any )  return;
+
+   Src_WorkBeforeMajorFunc( lv, TimeNew, TimeOld, dt );
+
+// tcool_min_for_solver[lv] will be set by Flu_Close()
+   tcool_min_for_solver[lv] = HUGE_NUMBER;
+
+} // FUNCTION : Src_BeginFusedUpdate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_EndFusedUpdate
+// Description :  Work after applying the local source terms in Flu_Close() when SRC_FUSE_FLUID is on
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() after the fluid solver succeeds
+//                2. Replace the second half of Src_AdvanceDt()
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                SaveSg_Flu : Sandglass storing the updated fluid data
+//-------------------------------------------------------------------------------------------------------
+void Src_EndFusedUpdate( const int lv, const double TimeNew, const int SaveSg_Flu )
+{
+
+   if ( SrcTerms.ExactCooling )
+   {
+      IsValid_tcool_min[lv] = true;
+      Src_ValidateTCool_ExactCooling( lv, SaveSg_Flu, TimeNew );
+   }
+
+} // FUNCTION : Src_EndFusedUpdate
@@ -1,6 +1,7 @@
 #include "GAMER.h"
 
 
+extern double tcool_min_for_solver[NLEVEL];
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -12,6 +13,10 @@
 //                   --> Should remove unused fields in the future
 //                2. Do not store B field
 //                3. Use the same array for input and output
+//                4. Get the minimum cooling time of the exact cooling in all target patches
+//                   --> Store it in the global variable "tcool_min_for_solver[lv]" declared in Src_AdvanceDt.cpp,
+//                       which must be initialized as an extremely large value in advance
+//                   --> Used by Mis_GetTimeStep_ExactCooling() to avoid another sweep over all patches
 //
 // Parameter   :  lv                : Target refinement level
 //                SaveSg_Flu        : Sandglass to store the updated fluid data
@@ -23,7 +28,9 @@ void Src_Close( const int lv, const int SaveSg_Flu, const real h_Flu_Array_S_Out
                 const int NPG, const int *PID0_List )
 {
 
-#  pragma omp parallel for schedule( static )
+   double tcool_min = HUGE_NUMBER;
+
+#  pragma omp parallel for reduction( min:tcool_min ) schedule( static )
    for (int TID=0; TID<NPG; TID++)
    {
       const int PID0 = PID0_List[TID];
@@ -36,7 +43,19 @@ void Src_Close( const int lv, const int SaveSg_Flu, const real h_Flu_Array_S_Out
 //       update all fluid variables for now
          memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid[0][0][0], h_Flu_Array_S_Out[N][0],
                  FLU_NOUT_S*CUBE(PS1)*sizeof(real) );
+
+//       get the minimum cooling time while the output data are still in cache
+#        ifdef TCOOL
+         if ( SrcTerms.ExactCooling )
+         {
+            const real *tcool = h_Flu_Array_S_Out[N][TCOOL];
+
+            for (int t=0; t<CUBE(PS1); t++)  tcool_min = fmin( tcool_min, (double)tcool[t] );
+         }
+#        endif
       }
    } // for (int TID=0; TID<NPG; TID++)
 
+   tcool_min_for_solver[lv] = fmin( tcool_min_for_solver[lv], tcool_min );
+
 } // FUNCTION : Src_Close
@@ -84,6 +84,7 @@ void Src_Init()
    SrcTerms.EC_TEF_lambda_DevPtr  = NULL;
    SrcTerms.EC_TEF_alpha_DevPtr   = NULL;
    SrcTerms.EC_TEFc_DevPtr        = NULL;
+   SrcTerms.EC_TEF_Coeff_DevPtr   = NULL;
 #  endif
 
    SrcTerms.User_FuncPtr              = NULL;